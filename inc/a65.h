@@ -23,16 +23,72 @@
 extern "C" {
 #endif // __cplusplus
 
+typedef struct a65_context_s a65_context_t;
+
+enum {
+	A65_OPTION_DEPEND = 0,
+	A65_OPTION_RELAX,
+};
+
+#define A65_OPTION_MAX A65_OPTION_RELAX
+
+enum {
+	A65_STATISTIC_CACHE_HIT = 0,
+	A65_STATISTIC_CACHE_MISS,
+	A65_STATISTIC_RELAXED,
+};
+
+#define A65_STATISTIC_MAX A65_STATISTIC_RELAXED
+
+extern int a65_add_include_path(const char *path);
+
+extern int a65_add_include_path_r(a65_context_t *context, const char *path);
+
 extern int a65_build_archive(int count, const char **input, const char *output, const char *name);
 
+extern int a65_build_archive_r(a65_context_t *context, int count, const char **input, const char *output, const char *name);
+
 extern int a65_build_object(const char *input, const char *output, int header, int source);
 
+extern int a65_build_object_r(a65_context_t *context, const char *input, const char *output, int header, int source);
+
 extern int a65_compile(int count, const char **input, const char *output, const char *name, int binary, int ihex);
 
+extern int a65_compile_r(a65_context_t *context, int count, const char **input, const char *output, const char *name, int binary,
+	int ihex);
+
+extern a65_context_t *a65_context_create(void);
+
+extern void a65_context_destroy(a65_context_t *context);
+
 extern const char *a65_error(void);
 
+extern const char *a65_error_r(const a65_context_t *context);
+
 extern const char *a65_output_path(void);
 
+extern const char *a65_output_path_r(const a65_context_t *context);
+
+extern int a65_precompile(const char *input, const char *output);
+
+extern int a65_precompile_r(a65_context_t *context, const char *input, const char *output);
+
+extern int a65_set_cache_path(const char *path);
+
+extern int a65_set_cache_path_r(a65_context_t *context, const char *path);
+
+extern int a65_set_depend_path(const char *path);
+
+extern int a65_set_depend_path_r(a65_context_t *context, const char *path);
+
+extern int a65_set_option(int option, int value);
+
+extern int a65_set_option_r(a65_context_t *context, int option, int value);
+
+extern unsigned long a65_statistic(int statistic);
+
+extern unsigned long a65_statistic_r(const a65_context_t *context, int statistic);
+
 extern void a65_version(int *major, int *minor, int *revision);
 
 #ifdef __cplusplus
@@ -23,6 +23,7 @@
 #include "./a65_archive.h"
 #include "./a65_parser.h"
 #include "./a65_section.h"
+#include "./a65_symbol.h"
 
 class a65_assembler :
 		public a65_parser {
@@ -47,6 +48,8 @@ class a65_assembler :
 			__in const std::string &name
 			);
 
+		bool build_cached(void) const;
+
 		std::string build_object(
 			__in const std::string &input,
 			__in const std::string &output,
@@ -64,6 +67,30 @@ class a65_assembler :
 			__in_opt bool ihex = false
 			);
 
+		std::string precompile(
+			__in const std::string &input,
+			__in const std::string &output
+			);
+
+		size_t relaxed(void) const;
+
+		void set_build_cache(
+			__in const std::string &path
+			);
+
+		void set_depend(
+			__in bool depend,
+			__in_opt const std::string &path = std::string()
+			);
+
+		void set_include_path(
+			__in const std::vector<std::string> &path
+			);
+
+		void set_relax(
+			__in bool relax
+			);
+
 	protected:
 
 		void add_define(
@@ -75,6 +102,15 @@ class a65_assembler :
 			__in const a65_token &token
 			);
 
+		void add_include(
+			__in const a65_token &token
+			);
+
+		void add_include_binary(
+			__in const a65_token &token,
+			__in const std::string &path
+			);
+
 		void add_label(
 			__in const a65_token &token,
 			__in uint16_t origin
@@ -85,16 +121,50 @@ class a65_assembler :
 			__in uint16_t origin
 			);
 
+		std::string build_cache_key(
+			__in const std::string &text
+			) const;
+
+		std::string build_cache_path(
+			__in const std::string &key,
+			__in const std::string &extension
+			) const;
+
+		std::string build_cache_text(
+			__in const std::string &name,
+			__in const std::string &data,
+			__in bool header,
+			__in bool source
+			) const;
+
+		void clear_cache(void);
+
+		void clear_expression(void);
+
+		void compile_expression(
+			__in a65_parser &parser,
+			__in a65_tree &tree
+			);
+
+		bool compile_expression_fold(
+			__inout a65_assembler_instruction_t &instruction,
+			__in const a65_token &entry
+			);
+
 		bool contains_define(
-			__in const std::string &name
+			__in uint32_t id
 			) const;
 
 		bool contains_export(
 			__in const std::string &name
 			) const;
 
+		bool contains_include(
+			__in uint32_t id
+			) const;
+
 		bool contains_label(
-			__in const std::string &name
+			__in uint32_t id
 			) const;
 
 		bool contains_section(
@@ -102,63 +172,231 @@ class a65_assembler :
 			) const;
 
 		void evaluate(
-			__in const std::string &name,
-			__in const std::string &input
+			__in a65_parser &parser
 			);
 
-		std::vector<uint8_t> evaluate(
+		void evaluate(
+			__in a65_parser &parser,
+			__in a65_tree &tree,
+			__inout std::vector<uint8_t> &result
+			);
+
+		int evaluate_branch(
+			__in int type,
+			__in uint16_t operand
+			) const;
+
+		int evaluate_branch_inverse(
+			__in int type
+			) const;
+
+		size_t evaluate_cache(
+			__in a65_parser &parser,
+			__in a65_tree &tree,
+			__inout a65_assembler_cache_t &cache,
+			__inout std::vector<uint8_t> &result
+			);
+
+		void evaluate_command(
+			__in a65_parser &parser,
+			__in a65_tree &tree,
+			__inout std::vector<uint8_t> &result
+			);
+
+		bool evaluate_condition(
 			__in a65_parser &parser,
 			__in a65_tree &tree
 			);
 
-		std::vector<uint8_t> evaluate_command(
+		bool evaluate_dependency(
+			__in const a65_assembler_cache_t &cache
+			);
+
+		void evaluate_directive(
+			__in a65_parser &parser,
+			__in a65_tree &tree,
+			__inout std::vector<uint8_t> &result
+			);
+
+		uint16_t evaluate_expression(
 			__in a65_parser &parser,
 			__in a65_tree &tree
 			);
 
-		bool evaluate_condition(
+		void evaluate_include(
+			__in a65_parser &parser,
+			__inout std::vector<uint8_t> &result
+			);
+
+		void evaluate_include_define(
+			__in const a65_assembler &include
+			);
+
+		bool evaluate_include_guard(
+			__in const a65_assembler &include
+			);
+
+		void evaluate_layout(void);
+
+		void evaluate_list(
+			__in a65_parser &parser,
+			__in a65_tree &tree,
+			__inout std::vector<uint8_t> &result
+			);
+
+		void evaluate_pragma(
+			__in a65_parser &parser,
+			__in a65_tree &tree,
+			__inout std::vector<uint8_t> &result
+			);
+
+		size_t evaluate_size(
 			__in a65_parser &parser,
 			__in a65_tree &tree
 			);
 
-		std::vector<uint8_t> evaluate_directive(
+		size_t evaluate_size_command(
 			__in a65_parser &parser,
 			__in a65_tree &tree
 			);
 
-		uint16_t evaluate_expression(
+		size_t evaluate_size_directive(
+			__in a65_parser &parser,
+			__in a65_tree &tree
+			);
+
+		size_t evaluate_size_include(
+			__in a65_parser &parser
+			);
+
+		size_t evaluate_size_layout(
+			__in a65_tree &tree,
+			__in size_t length
+			);
+
+		size_t evaluate_size_list(
 			__in a65_parser &parser,
 			__in a65_tree &tree
 			);
 
-		std::vector<uint8_t> evaluate_list(
+		size_t evaluate_size_pragma(
 			__in a65_parser &parser,
 			__in a65_tree &tree
 			);
 
-		std::vector<uint8_t> evaluate_pragma(
+		bool evaluate_size_short(
+			__in a65_tree &tree,
+			__in int mode
+			);
+
+		bool evaluate_symbol(
+			__in const a65_symbol_entry_t &symbol,
+			__inout uint16_t &value
+			);
+
+		std::string find_build_cache(
+			__in const std::string &key,
+			__in const std::string &text,
+			__in const std::string &name,
+			__in bool header,
+			__in bool source
+			);
+
+		std::string find_build_manifest(
+			__in const std::string &manifest,
+			__in const std::string &text,
+			__inout std::string &key_text
+			);
+
+		uint16_t find_define(
+			__in uint32_t id
+			) const;
+
+		const a65_assembler_expression_t &find_expression(
 			__in a65_parser &parser,
 			__in a65_tree &tree
 			);
 
-		std::map<std::string, uint16_t>::iterator find_define(
-			__in const std::string &name
+		std::map<uint32_t, a65_assembler>::iterator find_include(
+			__in uint32_t id
 			);
 
-		std::map<std::string, uint16_t>::iterator find_label(
-			__in const std::string &name
+		std::map<uint32_t, std::shared_ptr<const a65_buffer>>::iterator find_include_binary(
+			__in uint32_t id
+			);
+
+		bool find_include_define(
+			__inout std::vector<uint32_t> &token
+			) const;
+
+		bool find_include_define(
+			__inout a65_tree &tree,
+			__inout std::vector<uint32_t> &token
+			) const;
+
+		uint16_t find_label(
+			__in uint32_t id
+			) const;
+
+		a65_assembler_layout_t &find_layout(
+			__in a65_tree &tree
 			);
 
 		std::map<uint16_t, a65_section>::iterator find_section(
 			__in uint16_t origin
 			);
 
+		const a65_symbol_entry_t &find_symbol(
+			__in a65_tree &tree,
+			__in const a65_token &token
+			);
+
 		std::string form_ihex(
 			__in int type,
 			__in_opt uint16_t origin = 0,
 			__in_opt const std::vector<uint8_t> &data = std::vector<uint8_t>()
 			);
 
+		void insert_build_cache(
+			__in const std::string &key,
+			__in const std::string &text,
+			__in const std::string &name,
+			__in bool header,
+			__in bool source
+			);
+
+		void insert_build_file(
+			__in const std::string &path,
+			__in const std::vector<uint8_t> &data
+			);
+
+		void insert_build_manifest(
+			__in const std::string &manifest,
+			__in const std::string &text,
+			__in const std::string &key,
+			__in const std::string &key_text
+			);
+
+		void insert_cache(
+			__inout a65_assembler_cache_t &cache,
+			__in size_t length
+			);
+
+		void load_include(
+			__in const std::string &input
+			);
+
+		void load_include_define(
+			__in const a65_snapshot &snapshot
+			);
+
+		void load_include_guard(void);
+
+		std::shared_ptr<const a65_snapshot> load_include_precompiled(
+			__in const std::string &input,
+			__inout std::string &path
+			);
+
 		void move_child_tree(
 			__in a65_tree &tree,
 			__in size_t position
@@ -181,6 +419,10 @@ class a65_assembler :
 			__in const std::vector<a65_object> &object
 			);
 
+		std::string output_depend(
+			__in const std::string &object
+			);
+
 		std::string output_object(
 			__in const std::string &name,
 			__in_opt bool header = true
@@ -191,6 +433,11 @@ class a65_assembler :
 			__in const a65_object &object
 			);
 
+		std::string output_precompile(
+			__in const std::string &name,
+			__in const a65_snapshot &snapshot
+			);
+
 		std::string output_source(
 			__in const std::string &name,
 			__in const std::string &source
@@ -225,22 +472,81 @@ class a65_assembler :
 			__in a65_tree &tree
 			);
 
+		void preprocess_include(
+			__in a65_parser &parser,
+			__in a65_tree &tree
+			);
+
 		std::string preprocess_pragma(
 			__in a65_parser &parser,
 			__in a65_tree &tree
 			);
 
+		void preprocess_tree(
+			__in_opt const std::string &input = std::string()
+			);
+
 		void remove_define(
 			__in const a65_token &token
 			);
 
-		std::map<std::string, uint16_t> m_define;
+		std::string m_build_cache;
+
+		bool m_build_cached;
+
+		std::set<std::string> m_build_dependency;
+
+		std::set<std::string> m_build_missing;
+
+		std::map<const a65_parser *, std::vector<a65_assembler_cache_t>> m_cache;
+
+		std::vector<a65_assembler_dependency_t> m_cache_dependency;
+
+		std::vector<a65_assembler_dependency_t> m_dependency;
+
+		bool m_dependency_record;
+
+		bool m_depend;
+
+		std::string m_depend_path;
 
 		std::set<std::string> m_export;
 
+		std::vector<a65_assembler_expression_t> m_expression;
+
+		std::vector<a65_assembler_instruction_t> m_expression_code;
+
+		std::string m_expression_literal;
+
+		std::vector<uint16_t> m_expression_stack;
+
+		std::vector<a65_section_fill_t> m_fill;
+
+		bool m_forward;
+
+		std::map<uint32_t, a65_assembler> m_include;
+
+		std::map<uint32_t, uint32_t> m_include_alias;
+
+		std::map<uint32_t, std::shared_ptr<const a65_buffer>> m_include_binary;
+
+		std::vector<std::pair<uint32_t, uint16_t>> m_include_define;
+
+		std::set<std::string> m_include_evaluated;
+
+		uint32_t m_include_guard;
+
+		std::string m_include_identity;
+
+		std::map<std::string, uint32_t> m_include_loaded;
+
+		bool m_include_once;
+
+		std::vector<std::string> m_include_path;
+
 		std::string m_input;
 
-		std::map<std::string, uint16_t> m_label;
+		std::vector<a65_assembler_layout_t> m_layout;
 
 		std::string m_name;
 
@@ -250,9 +556,15 @@ class a65_assembler :
 
 		std::string m_output;
 
+		bool m_relax;
+
+		size_t m_relaxed;
+
 		bool m_second_pass;
 
 		std::map<uint16_t, a65_section> m_section;
+
+		a65_symbol m_symbol;
 };
 
 #endif // A65_ASSEMBLER_H_
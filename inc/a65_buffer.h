@@ -0,0 +1,72 @@
+/**
+ * A65
+ * Copyright (C) 2018 David Jolly
+ *
+ * A65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef A65_BUFFER_H_
+#define A65_BUFFER_H_
+
+#include "./a65_buffer_type.h"
+
+class a65_buffer {
+
+	public:
+
+		a65_buffer(
+			__in_opt const std::string &input = std::string(),
+			__in_opt bool is_path = false
+			);
+
+		~a65_buffer(void);
+
+		const char *data(void) const;
+
+		size_t length(void) const;
+
+		bool mapped(void) const;
+
+		size_t size(void) const;
+
+		std::string to_string(void) const;
+
+	protected:
+
+		a65_buffer(
+			__in const a65_buffer &other
+			) = delete;
+
+		a65_buffer &operator=(
+			__in const a65_buffer &other
+			) = delete;
+
+		bool load_mapped(
+			__in const std::string &path
+			);
+
+		void load_stream(
+			__in const std::string &path
+			);
+
+		std::string m_character;
+
+		size_t m_length;
+
+		void *m_map;
+
+		size_t m_map_length;
+};
+
+#endif // A65_BUFFER_H_
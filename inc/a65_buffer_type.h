@@ -0,0 +1,32 @@
+/**
+ * A65
+ * Copyright (C) 2018 David Jolly
+ *
+ * A65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef A65_BUFFER_TYPE_H_
+#define A65_BUFFER_TYPE_H_
+
+#include "./a65_define.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define A65_BUFFER_MAP_SUPPORTED
+#endif // defined(__unix__) || defined(__APPLE__)
+
+#define A65_BUFFER_MAP_LENGTH_MIN 0x4000
+
+#define A65_BUFFER_SENTINEL '\0'
+
+#endif // A65_BUFFER_TYPE_H_
@@ -24,6 +24,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include <cctype>
 #include <fstream>
@@ -34,6 +35,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #ifndef __in
@@ -78,7 +80,7 @@
 	std::transform((_STRING_).begin(), (_STRING_).end(), (_STRING_).begin(), ::tolower)
 
 #define A65_VERSION_MAJOR 0
-#define A65_VERSION_MINOR 2
-#define A65_VERSION_REVISION 1
+#define A65_VERSION_MINOR 3
+#define A65_VERSION_REVISION 0
 
 #endif // A65_DEFINE_H_
@@ -51,6 +51,8 @@ class a65_id {
 		void increment(void);
 
 		uint32_t m_id;
+
+		a65_uuid *m_uuid;
 };
 
 #endif // A65_ID_H_
@@ -0,0 +1,47 @@
+/**
+ * A65
+ * Copyright (C) 2018 David Jolly
+ *
+ * A65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef A65_INCLUDE_H_
+#define A65_INCLUDE_H_
+
+#include "./a65_include_type.h"
+#include "./a65_snapshot.h"
+
+class a65_include {
+
+	public:
+
+		static void clear(void);
+
+		static bool identify(
+			__in const std::string &path,
+			__inout a65_snapshot_identity_t &identity
+			);
+
+		static std::string resolve(
+			__in const std::string &directory,
+			__in const std::string &name,
+			__in const std::vector<std::string> &search,
+			__inout std::set<std::string> &missing
+			);
+
+	protected:
+
+		a65_include(void) = delete;
+};
+
+#endif // A65_INCLUDE_H_
@@ -0,0 +1,67 @@
+/**
+ * A65
+ * Copyright (C) 2018 David Jolly
+ *
+ * A65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef A65_INTERN_H_
+#define A65_INTERN_H_
+
+#include "./a65_intern_type.h"
+
+class a65_intern {
+
+	public:
+
+		a65_intern(void);
+
+		~a65_intern(void);
+
+		static a65_intern *bind(
+			__in_opt a65_intern *context = nullptr
+			);
+
+		size_t count(void) const;
+
+		const std::string &find(
+			__in uint32_t id
+			) const;
+
+		uint32_t generate(
+			__in const std::string &value
+			);
+
+		static a65_intern &instance(void);
+
+	protected:
+
+		a65_intern(
+			__in const a65_intern &other
+			) = delete;
+
+		a65_intern &operator=(
+			__in const a65_intern &other
+			) = delete;
+
+		std::unordered_map<std::string, uint32_t> m_entry;
+
+		mutable std::mutex m_mutex;
+
+		uint32_t m_next;
+
+		std::atomic<a65_intern_page_t *> m_page[A65_INTERN_PAGE_COUNT];
+};
+
+#endif // A65_INTERN_H_
@@ -0,0 +1,44 @@
+/**
+ * A65
+ * Copyright (C) 2018 David Jolly
+ *
+ * A65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef A65_INTERN_TYPE_H_
+#define A65_INTERN_TYPE_H_
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include "./a65_define.h"
+
+#define A65_INTERN_INVALID 0
+
+#define A65_INTERN_PAGE_COUNT 0x400
+#define A65_INTERN_PAGE_LENGTH 0x400
+
+#define A65_INTERN_MAX ((A65_INTERN_PAGE_COUNT * A65_INTERN_PAGE_LENGTH) - 1)
+
+#define A65_INTERN_PAGE(_ID_) \
+	((_ID_) / A65_INTERN_PAGE_LENGTH)
+
+#define A65_INTERN_PAGE_OFFSET(_ID_) \
+	((_ID_) % A65_INTERN_PAGE_LENGTH)
+
+typedef struct {
+	const std::string *entry[A65_INTERN_PAGE_LENGTH];
+} a65_intern_page_t;
+
+#endif // A65_INTERN_TYPE_H_
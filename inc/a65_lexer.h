@@ -20,6 +20,7 @@
 #define A65_LEXER_H_
 
 #include "./a65_lexer_type.h"
+#include "./a65_snapshot.h"
 #include "./a65_stream.h"
 #include "./a65_token.h"
 
@@ -93,6 +94,10 @@ class a65_lexer :
 
 		a65_token token_end(void) const;
 
+		const a65_token &token_ref(
+			__in_opt uint32_t id = A65_UUID_INVALID
+			) const;
+
 	protected:
 
 		void add(
@@ -108,6 +113,8 @@ class a65_lexer :
 
 		char enumerate_alpha_character(void);
 
+		std::string_view enumerate_alpha_identifier(void);
+
 		void enumerate_alpha_directive(
 			__inout a65_token &token
 			);
@@ -141,12 +148,46 @@ class a65_lexer :
 			__inout a65_token &token
 			);
 
+		void export_snapshot(
+			__inout a65_snapshot &snapshot,
+			__inout std::map<uint32_t, uint32_t> &index
+			) const;
+
 		std::map<uint32_t, a65_token>::iterator find(
 			__in uint32_t id
 			);
 
+		static bool find_keyword(
+			__in const std::string_view &literal,
+			__inout int &type,
+			__inout int &subtype
+			);
+
+		void import_snapshot(
+			__in const a65_snapshot &snapshot,
+			__in const std::string &path,
+			__inout std::vector<uint32_t> &id
+			);
+
+		static void insert_keyword(
+			__inout a65_lexer_keyword_table_t &table,
+			__in const std::string &literal,
+			__in int type,
+			__in int subtype
+			);
+
+		static uint64_t keyword_key(
+			__in const std::string_view &literal
+			);
+
+		static const a65_lexer_keyword_table_t &keyword_table(void);
+
+		static a65_lexer_keyword_table_t keyword_table_build(void);
+
 		void skip(void);
 
+		uint32_t m_file;
+
 		std::vector<uint32_t> m_token;
 
 		std::map<uint32_t, a65_token> m_token_map;
@@ -36,6 +36,27 @@
 #define A65_CHARACTER_UNDERSCORE '_'
 #define A65_CHARACTER_ZERO '0'
 
+#define A65_LEXER_KEYWORD_LENGTH_MAX sizeof(uint64_t)
+#define A65_LEXER_KEYWORD_SEED 0x9e3779b97f4a7c15ULL
+#define A65_LEXER_KEYWORD_SEED_ATTEMPT 0x10000
+#define A65_LEXER_KEYWORD_SHIFT 52
+#define A65_LEXER_KEYWORD_SLOT_COUNT (1 << ((sizeof(uint64_t) * 8) - A65_LEXER_KEYWORD_SHIFT))
+
+#define A65_LEXER_KEYWORD_HASH(_KEY_, _SEED_) \
+	(((_KEY_) * (_SEED_)) >> A65_LEXER_KEYWORD_SHIFT)
+
+typedef struct {
+	uint64_t key;
+	int type;
+	int subtype;
+} a65_lexer_keyword_t;
+
+typedef struct {
+	std::vector<a65_lexer_keyword_t> keyword;
+	uint64_t seed;
+	uint8_t slot[A65_LEXER_KEYWORD_SLOT_COUNT];
+} a65_lexer_keyword_table_t;
+
 #define A65_SCALAR_BINARY_BASE 2
 #define A65_SCALAR_BINARY_LENGTH_MAX 16
 #define A65_SCALAR_DECIMAL_LENGTH_MAX 5
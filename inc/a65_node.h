@@ -22,16 +22,16 @@
 #include "./a65_id.h"
 #include "./a65_node_type.h"
 
-class a65_node :
-		public a65_id {
+class a65_node {
 
 	public:
 
 		a65_node(
 			__in_opt int type = A65_NODE_BEGIN,
 			__in_opt uint32_t token = A65_UUID_INVALID,
-			__in_opt uint32_t parent = A65_UUID_INVALID,
-			__in_opt const std::vector<uint32_t> &child = std::vector<uint32_t>()
+			__in_opt uint32_t parent = A65_NODE_INVALID,
+			__in_opt uint32_t child = 0,
+			__in_opt uint32_t child_count = 0
 			);
 
 		a65_node(
@@ -44,14 +44,7 @@ class a65_node :
 			__in const a65_node &other
 			);
 
-		size_t add_child(
-			__in uint32_t id,
-			__in_opt size_t position = A65_NODE_POSITION_UNDEFINED
-			);
-
-		uint32_t child(
-			__in size_t position
-			) const;
+		uint32_t child(void) const;
 
 		size_t child_count(void) const;
 
@@ -73,29 +66,29 @@ class a65_node :
 
 		uint32_t parent(void) const;
 
-		void remove_all_children(void);
-
-		void remove_child(
-			__in size_t position
-			);
-
 		void set(
 			__in int type
 			);
 
 		void set_child(
-			__in uint32_t id,
-			__in size_t position
+			__in uint32_t child,
+			__in uint32_t child_count
 			);
 
 		void set_parent(
 			__in uint32_t id
 			);
 
+		void set_slot(
+			__in uint32_t slot
+			);
+
 		void set_token(
 			__in uint32_t id
 			);
 
+		uint32_t slot(void) const;
+
 		uint32_t token(void) const;
 
 		virtual std::string to_string(void) const;
@@ -104,10 +97,14 @@ class a65_node :
 
 	protected:
 
-		std::vector<uint32_t> m_child;
+		uint32_t m_child;
+
+		uint32_t m_child_count;
 
 		uint32_t m_parent;
 
+		uint32_t m_slot;
+
 		uint32_t m_token;
 
 		int m_type;
@@ -40,6 +40,10 @@ enum {
 
 #define A65_NODE_MAX A65_NODE_UNARY
 
+#define A65_NODE_INVALID UINT32_MAX
+
+#define A65_NODE_SLOT_INVALID UINT32_MAX
+
 #define A65_NODE_POSITION_UNDEFINED (-1)
 
 static const std::string A65_NODE_STR[] = {
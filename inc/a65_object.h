@@ -75,6 +75,11 @@ class a65_object :
 			__in const std::vector<uint8_t> &data
 			);
 
+		uint16_t link(
+			__in size_t position,
+			__inout std::vector<uint8_t> &image
+			) const;
+
 		void read(
 			__in const std::string &path
 			);
@@ -105,10 +110,21 @@ class a65_object :
 			__in const a65_object &other
 			);
 
+		void expand(
+			__in size_t position,
+			__inout uint8_t *data
+			) const;
+
+		const a65_object_fill_t *fill(void) const;
+
 		std::map<std::string, uint32_t>::const_iterator find(
 			__in const std::string &name
 			) const;
 
+		uint32_t length(
+			__in size_t position
+			) const;
+
 		a65_object_header_t m_header;
 
 		a65_object_payload_t *m_payload;
@@ -46,10 +46,17 @@ typedef struct __attribute__((packed)) {
 	char name[A65_OBJECT_SECTION_NAME_MAX];
 } a65_object_section_t;
 
+typedef struct __attribute__((packed)) {
+	uint32_t section;
+	uint32_t offset;
+	uint32_t length;
+	uint8_t value;
+} a65_object_fill_t;
+
 typedef struct __attribute__((packed)) {
 	uint32_t count;
 	uint32_t size;
-	uint32_t reserved;
+	uint32_t fill;
 } a65_object_payload_metadata_t;
 
 typedef struct __attribute__((packed)) {
@@ -74,6 +74,14 @@ class a65_parser :
 
 		a65_tree tree_end(void) const;
 
+		a65_tree &tree_ref(
+			__in_opt uint32_t id = A65_UUID_INVALID
+			);
+
+		const a65_tree &tree_ref(
+			__in_opt uint32_t id = A65_UUID_INVALID
+			) const;
+
 	protected:
 
 		void add(
@@ -224,14 +232,70 @@ class a65_parser :
 			__inout a65_tree &tree
 			);
 
+		void enumerate_pragma_once(
+			__inout a65_tree &tree
+			);
+
 		void enumerate_statement_list(
 			__inout a65_tree &tree
 			);
 
+		static uint16_t evaluate_macro(
+			__in int subtype,
+			__in uint16_t value
+			);
+
+		static uint16_t evaluate_operator(
+			__in int subtype,
+			__in uint16_t left,
+			__in uint16_t right
+			);
+
+		static uint16_t evaluate_unary(
+			__in int subtype,
+			__in uint16_t value
+			);
+
+		void export_snapshot(
+			__inout a65_snapshot &snapshot
+			) const;
+
+		static void export_snapshot_child(
+			__inout a65_tree &tree,
+			__in const std::map<uint32_t, uint32_t> &index,
+			__inout a65_snapshot &snapshot
+			);
+
+		static void export_snapshot_node(
+			__inout a65_tree &tree,
+			__in const std::map<uint32_t, uint32_t> &index,
+			__inout a65_snapshot &snapshot
+			);
+
 		std::map<uint32_t, a65_tree>::iterator find(
 			__in uint32_t id
 			);
 
+		void import_snapshot(
+			__in const a65_snapshot &snapshot,
+			__in const std::string &path
+			);
+
+		static void import_snapshot_child(
+			__inout a65_tree &tree,
+			__in const a65_snapshot &snapshot,
+			__in const std::vector<uint32_t> &id,
+			__in size_t count,
+			__inout size_t &position
+			);
+
+		static void import_snapshot_node(
+			__inout a65_tree &tree,
+			__in const a65_snapshot &snapshot,
+			__in const std::vector<uint32_t> &id,
+			__inout size_t &position
+			);
+
 		std::vector<uint32_t> m_tree;
 
 		std::map<uint32_t, a65_tree> m_tree_map;
@@ -44,19 +44,28 @@ class a65_section :
 
 		void add(
 			__in const std::vector<uint8_t> &data,
-			__in uint32_t listing
+			__in uint32_t listing,
+			__in_opt const std::vector<a65_section_fill_t> &fill = std::vector<a65_section_fill_t>()
 			);
 
 		void clear(void);
 
 		size_t count(void) const;
 
+		const std::vector<uint8_t> &data(void) const;
+
 		std::vector<uint8_t> data(
 			__in size_t position
 			) const;
 
 		bool empty(void) const;
 
+		const std::vector<a65_section_fill_t> &fill(void) const;
+
+		size_t length(
+			__in size_t position
+			) const;
+
 		uint32_t listing(
 			__in size_t position
 			) const;
@@ -83,11 +92,15 @@ class a65_section :
 
 	protected:
 
-		std::tuple<std::vector<uint8_t>, uint16_t, uint32_t> find(
+		const a65_section_listing_t &find(
 			__in size_t position
 			) const;
 
-		std::vector<std::tuple<std::vector<uint8_t>, uint16_t, uint32_t>> m_listing;
+		std::vector<uint8_t> m_data;
+
+		std::vector<a65_section_fill_t> m_fill;
+
+		std::vector<a65_section_listing_t> m_listing;
 
 		std::string m_name;
 
@@ -23,10 +23,20 @@
 
 #define A65_SECTION_KB_LENGTH 1024.f
 
-enum {
-	A65_SECTION_DATA = 0,
-	A65_SECTION_LISTING,
-	A65_SECTION_OFFSET,
-};
+#define A65_SECTION_LENGTH_MAX UINT16_MAX
+
+typedef struct {
+	uint32_t offset;
+	uint32_t length;
+	uint8_t value;
+} a65_section_fill_t;
+
+typedef struct {
+	uint32_t offset;
+	uint32_t length;
+	uint32_t listing;
+	uint32_t data;
+	uint32_t fill;
+} a65_section_listing_t;
 
 #endif // A65_SECTION_TYPE_H_
@@ -0,0 +1,158 @@
+/**
+ * A65
+ * Copyright (C) 2018 David Jolly
+ *
+ * A65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef A65_SNAPSHOT_H_
+#define A65_SNAPSHOT_H_
+
+#include "./a65_snapshot_type.h"
+#include "./a65_buffer.h"
+#include "./a65_token.h"
+
+class a65_snapshot {
+
+	public:
+
+		a65_snapshot(void);
+
+		a65_snapshot(
+			__in const a65_snapshot &other
+			);
+
+		virtual ~a65_snapshot(void);
+
+		a65_snapshot &operator=(
+			__in const a65_snapshot &other
+			);
+
+		void add_define(
+			__in uint16_t value
+			);
+
+		void add_node(
+			__in int type,
+			__in uint32_t token,
+			__in size_t child_count
+			);
+
+		uint32_t add_token(
+			__in const a65_token &token
+			);
+
+		void add_token_sequence(
+			__in uint32_t token
+			);
+
+		void add_tree(
+			__in int type
+			);
+
+		std::vector<uint8_t> as_data(void) const;
+
+		void clear(void);
+
+		uint16_t define(
+			__in size_t position
+			) const;
+
+		size_t define_count(void) const;
+
+		static std::shared_ptr<const a65_snapshot> find(
+			__in const a65_snapshot_identity_t &identity
+			);
+
+		static bool identify(
+			__in const std::string &path,
+			__inout a65_snapshot_identity_t &identity
+			);
+
+		bool import(
+			__in const a65_buffer &buffer
+			);
+
+		static void insert(
+			__in const a65_snapshot_identity_t &identity,
+			__in const std::shared_ptr<const a65_snapshot> &snapshot
+			);
+
+		const a65_snapshot_node_t &node(
+			__in size_t position
+			) const;
+
+		bool read(
+			__in const std::string &path
+			);
+
+		uint32_t sequence(
+			__in size_t position
+			) const;
+
+		size_t sequence_count(void) const;
+
+		void set_source(
+			__in const a65_snapshot_identity_t &source
+			);
+
+		const a65_snapshot_identity_t &source(void) const;
+
+		const std::string &string(
+			__in uint32_t position
+			) const;
+
+		size_t string_count(void) const;
+
+		std::string to_string(void) const;
+
+		const a65_snapshot_token_t &token(
+			__in size_t position
+			) const;
+
+		size_t token_count(void) const;
+
+		const a65_snapshot_tree_t &tree(
+			__in size_t position
+			) const;
+
+		size_t tree_count(void) const;
+
+		void write(
+			__in const std::string &path
+			) const;
+
+	protected:
+
+		uint32_t add_string(
+			__in const std::string &value
+			);
+
+		std::vector<uint16_t> m_define;
+
+		std::vector<a65_snapshot_node_t> m_node;
+
+		a65_snapshot_identity_t m_source;
+
+		std::vector<std::string> m_string;
+
+		std::unordered_map<std::string, uint32_t> m_string_index;
+
+		std::vector<a65_snapshot_token_t> m_token;
+
+		std::vector<uint32_t> m_token_sequence;
+
+		std::vector<a65_snapshot_tree_t> m_tree;
+};
+
+#endif // A65_SNAPSHOT_H_
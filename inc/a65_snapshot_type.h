@@ -0,0 +1,99 @@
+/**
+ * A65
+ * Copyright (C) 2018 David Jolly
+ *
+ * A65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef A65_SNAPSHOT_TYPE_H_
+#define A65_SNAPSHOT_TYPE_H_
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "./a65_object_type.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define A65_SNAPSHOT_CACHE_SUPPORTED
+#endif // defined(__unix__) || defined(__APPLE__)
+
+#define A65_SNAPSHOT_TIME(_TIME_) \
+	(((int64_t)(_TIME_).tv_sec * 1000000000LL) + (_TIME_).tv_nsec)
+
+#ifdef __APPLE__
+#define A65_SNAPSHOT_TIME_CHANGE(_STATUS_) \
+	A65_SNAPSHOT_TIME((_STATUS_).st_ctimespec)
+#define A65_SNAPSHOT_TIME_MODIFY(_STATUS_) \
+	A65_SNAPSHOT_TIME((_STATUS_).st_mtimespec)
+#else
+#define A65_SNAPSHOT_TIME_CHANGE(_STATUS_) \
+	A65_SNAPSHOT_TIME((_STATUS_).st_ctim)
+#define A65_SNAPSHOT_TIME_MODIFY(_STATUS_) \
+	A65_SNAPSHOT_TIME((_STATUS_).st_mtim)
+#endif // __APPLE__
+
+#define A65_SNAPSHOT_INVALID UINT32_MAX
+
+#define A65_SNAPSHOT_TYPE 3
+
+typedef struct {
+	std::string path;
+	uint64_t device;
+	uint64_t inode;
+	uint64_t size;
+	int64_t time;
+	int64_t change;
+} a65_snapshot_identity_t;
+
+typedef struct __attribute__((packed)) {
+	int type;
+	uint32_t token;
+	uint32_t child_count;
+} a65_snapshot_node_t;
+
+typedef struct __attribute__((packed)) {
+	uint16_t revision;
+	uint64_t size;
+	int64_t time;
+	int64_t change;
+	uint32_t define;
+	uint32_t node;
+	uint32_t sequence;
+	uint32_t string;
+	uint32_t string_size;
+	uint32_t token;
+	uint32_t tree;
+} a65_snapshot_payload_metadata_t;
+
+typedef struct __attribute__((packed)) {
+	uint32_t path_size;
+} a65_snapshot_payload_source_t;
+
+typedef struct __attribute__((packed)) {
+	int type;
+	int subtype;
+	int mode;
+	uint16_t scalar;
+	uint32_t file;
+	uint32_t literal;
+	uint32_t line;
+	uint32_t column;
+} a65_snapshot_token_t;
+
+typedef struct __attribute__((packed)) {
+	int type;
+	uint32_t node;
+	uint32_t node_count;
+} a65_snapshot_tree_t;
+
+#endif // A65_SNAPSHOT_TYPE_H_
@@ -20,6 +20,7 @@
 #define A65_STREAM_H_
 
 #include "./a65_stream_type.h"
+#include "./a65_buffer.h"
 
 class a65_stream {
 
@@ -46,6 +47,8 @@ class a65_stream {
 
 		virtual void clear(void);
 
+		size_t column(void) const;
+
 		virtual bool has_next(void) const;
 
 		virtual bool has_previous(void) const;
@@ -82,6 +85,8 @@ class a65_stream {
 
 		virtual void reset(void);
 
+		static int scan_mode(void);
+
 		virtual void set_metadata(
 			__in const std::string &path
 			);
@@ -91,11 +96,56 @@ class a65_stream {
 			__in size_t line
 			);
 
+		void skip_line(void);
+
+		void skip_space(void);
+
 		virtual std::string to_string(void) const;
 
 	protected:
 
-		std::string m_character;
+		static size_t scan_line(
+			__in const char *data,
+			__in size_t position,
+			__in size_t length
+			);
+
+		static size_t scan_line_avx2(
+			__in const char *data,
+			__in size_t position,
+			__in size_t length
+			);
+
+		static size_t scan_line_sse2(
+			__in const char *data,
+			__in size_t position,
+			__in size_t length
+			);
+
+		static size_t scan_space(
+			__in const char *data,
+			__in size_t position,
+			__in size_t length,
+			__inout size_t &line
+			);
+
+		static size_t scan_space_avx2(
+			__in const char *data,
+			__in size_t position,
+			__in size_t length,
+			__inout size_t &line
+			);
+
+		static size_t scan_space_sse2(
+			__in const char *data,
+			__in size_t position,
+			__in size_t length,
+			__inout size_t &line
+			);
+
+		std::shared_ptr<a65_buffer> m_buffer;
+
+		std::string_view m_character;
 
 		size_t m_character_position;
 
@@ -19,8 +19,19 @@
 #ifndef A65_STREAM_TYPE_H_
 #define A65_STREAM_TYPE_H_
 
+#include <memory>
 #include "./a65_define.h"
 
+#if defined(__x86_64__) || defined(__i386__)
+#define A65_STREAM_SCAN_X86
+#include <immintrin.h>
+#define A65_STREAM_SCAN_TARGET_AVX2 __attribute__((target("avx2")))
+#define A65_STREAM_SCAN_TARGET_SSE2 __attribute__((target("sse2")))
+#else
+#define A65_STREAM_SCAN_TARGET_AVX2
+#define A65_STREAM_SCAN_TARGET_SSE2
+#endif // __x86_64__ || __i386__
+
 #define A65_CHARACTER_END '\0'
 #define A65_CHARACTER_FILL '.'
 #define A65_CHARACTER_NEGATION '-'
@@ -40,6 +51,12 @@ enum {
 
 #define A65_STREAM_CHARACTER_MAX A65_STREAM_CHARACTER_SYMBOL
 
+#define A65_STREAM_CHARACTER_FLAG_DECIMAL 0x10
+#define A65_STREAM_CHARACTER_FLAG_HEXIDECIMAL 0x20
+#define A65_STREAM_CHARACTER_FLAG_IDENTIFIER 0x40
+#define A65_STREAM_CHARACTER_MASK 0x0f
+#define A65_STREAM_CHARACTER_TABLE_LENGTH (UINT8_MAX + 1)
+
 static const std::string A65_STREAM_CHARACTER_STR[] = {
 	"Alpha", "Digit", "End", "Space", "Symbol",
 	};
@@ -48,6 +65,73 @@ static const std::string A65_STREAM_CHARACTER_STR[] = {
 	(((_TYPE_) > A65_STREAM_CHARACTER_MAX) ? A65_STRING_UNKNOWN : \
 		A65_STRING_CHECK(A65_STREAM_CHARACTER_STR[_TYPE_]))
 
+typedef struct a65_stream_character_table_s {
+
+	constexpr a65_stream_character_table_s(void) :
+		entry()
+	{
+
+		for(size_t value = 0; value < A65_STREAM_CHARACTER_TABLE_LENGTH; ++value) {
+			uint8_t type = A65_STREAM_CHARACTER_SYMBOL;
+
+			if(value == A65_CHARACTER_END) {
+				type = A65_STREAM_CHARACTER_END;
+			} else if(((value >= 'a') && (value <= 'z')) || ((value >= 'A') && (value <= 'Z'))) {
+				type = (A65_STREAM_CHARACTER_ALPHA | A65_STREAM_CHARACTER_FLAG_IDENTIFIER);
+
+				if(((value >= 'a') && (value <= 'f')) || ((value >= 'A') && (value <= 'F'))) {
+					type |= A65_STREAM_CHARACTER_FLAG_HEXIDECIMAL;
+				}
+			} else if((value >= '0') && (value <= '9')) {
+				type = (A65_STREAM_CHARACTER_DIGIT | A65_STREAM_CHARACTER_FLAG_DECIMAL | A65_STREAM_CHARACTER_FLAG_HEXIDECIMAL
+					| A65_STREAM_CHARACTER_FLAG_IDENTIFIER);
+			} else if((value == ' ') || ((value >= '\t') && (value <= '\r'))) {
+				type = A65_STREAM_CHARACTER_SPACE;
+			} else if(value == '_') {
+				type |= A65_STREAM_CHARACTER_FLAG_IDENTIFIER;
+			}
+
+			entry[value] = type;
+		}
+	}
+
+	uint8_t entry[A65_STREAM_CHARACTER_TABLE_LENGTH];
+} a65_stream_character_table_t;
+
+static constexpr a65_stream_character_table_t A65_STREAM_CHARACTER_TABLE;
+
+#define A65_STREAM_CHARACTER_CLASS(_VALUE_) \
+	(A65_STREAM_CHARACTER_TABLE.entry[(uint8_t) (_VALUE_)] & A65_STREAM_CHARACTER_MASK)
+
+#define A65_IS_STREAM_CHARACTER_FLAG(_VALUE_, _FLAG_) \
+	((A65_STREAM_CHARACTER_TABLE.entry[(uint8_t) (_VALUE_)] & (_FLAG_)) == (_FLAG_))
+
+#define A65_STREAM_COLUMN_START 1
+
+#define A65_STREAM_SCAN_WIDTH_AVX2 32
+#define A65_STREAM_SCAN_WIDTH_SSE2 16
+
+enum {
+	A65_STREAM_SCAN_SCALAR = 0,
+	A65_STREAM_SCAN_SSE2,
+	A65_STREAM_SCAN_AVX2,
+};
+
+#define A65_STREAM_SCAN_MAX A65_STREAM_SCAN_AVX2
+
+static const std::string A65_STREAM_SCAN_STR[] = {
+	"Scalar", "SSE2", "AVX2",
+	};
+
+#define A65_STREAM_SCAN_STRING(_TYPE_) \
+	(((_TYPE_) > A65_STREAM_SCAN_MAX) ? A65_STRING_UNKNOWN : \
+		A65_STRING_CHECK(A65_STREAM_SCAN_STR[_TYPE_]))
+
+#define A65_STREAM_SCAN_SPACE_HIGH '\r'
+#define A65_STREAM_SCAN_SPACE_LOW '\t'
+#define A65_STREAM_SCAN_SPACE ' '
+
+
 #define A65_STREAM_LINE_START 1
 
 #endif // A65_STREAM_TYPE_H_
@@ -0,0 +1,111 @@
+/**
+ * A65
+ * Copyright (C) 2018 David Jolly
+ *
+ * A65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef A65_SYMBOL_H_
+#define A65_SYMBOL_H_
+
+#include "./a65_symbol_type.h"
+
+class a65_symbol {
+
+	public:
+
+		a65_symbol(void);
+
+		a65_symbol(
+			__in const a65_symbol &other
+			);
+
+		~a65_symbol(void);
+
+		a65_symbol &operator=(
+			__in const a65_symbol &other
+			);
+
+		void clear(
+			__in int type
+			);
+
+		uint32_t compare(
+			__in int type,
+			__in int other
+			) const;
+
+		bool contains(
+			__in int type,
+			__in uint32_t id
+			) const;
+
+		void copy(
+			__in int type,
+			__in int other
+			);
+
+		const a65_symbol_entry_t &entry(
+			__in uint32_t slot
+			) const;
+
+		uint32_t find(
+			__in uint32_t id
+			) const;
+
+		uint32_t insert(
+			__in uint32_t id
+			);
+
+		bool match(
+			__in uint32_t slot,
+			__in uint32_t id
+			) const;
+
+		void remove(
+			__in int type,
+			__in uint32_t slot
+			);
+
+		void set(
+			__in int type,
+			__in uint32_t slot,
+			__in uint16_t value
+			);
+
+		size_t size(void) const;
+
+		std::string to_string(void) const;
+
+		uint16_t value(
+			__in int type,
+			__in uint32_t id
+			) const;
+
+	protected:
+
+		void link(
+			__in uint32_t slot
+			);
+
+		void rehash(
+			__in size_t capacity
+			);
+
+		std::vector<a65_symbol_entry_t> m_entry;
+
+		std::vector<uint32_t> m_index;
+};
+
+#endif // A65_SYMBOL_H_
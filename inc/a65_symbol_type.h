@@ -0,0 +1,59 @@
+/**
+ * A65
+ * Copyright (C) 2018 David Jolly
+ *
+ * A65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef A65_SYMBOL_TYPE_H_
+#define A65_SYMBOL_TYPE_H_
+
+#include "./a65_define.h"
+
+#define A65_SYMBOL_CAPACITY_MIN 0x40
+
+#define A65_SYMBOL_HASH(_ID_) \
+	((uint32_t)(_ID_) * 0x9e3779b9u)
+
+#define A65_SYMBOL_INVALID UINT32_MAX
+
+#define A65_SYMBOL_LOAD_MAX(_CAPACITY_) \
+	(((_CAPACITY_) / 4) * 3)
+
+enum {
+	A65_SYMBOL_DEFINE = 0,
+	A65_SYMBOL_LABEL,
+	A65_SYMBOL_LABEL_ESTIMATE,
+};
+
+#define A65_SYMBOL_MAX A65_SYMBOL_LABEL_ESTIMATE
+
+static const std::string A65_SYMBOL_STR[] = {
+	"Define", "Label", "Label estimate",
+	};
+
+#define A65_SYMBOL_STRING(_TYPE_) \
+	(((_TYPE_) > A65_SYMBOL_MAX) ? A65_STRING_UNKNOWN : \
+		A65_STRING_CHECK(A65_SYMBOL_STR[_TYPE_]))
+
+#define A65_SYMBOL_FLAG(_TYPE_) \
+	(1 << (_TYPE_))
+
+typedef struct {
+	uint32_t id;
+	uint16_t value[A65_SYMBOL_MAX + 1];
+	uint8_t flag;
+} a65_symbol_entry_t;
+
+#endif // A65_SYMBOL_TYPE_H_
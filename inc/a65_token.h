@@ -20,6 +20,7 @@
 #define A65_TOKEN_H_
 
 #include "./a65_id.h"
+#include "./a65_intern.h"
 #include "./a65_token_type.h"
 
 class a65_token :
@@ -43,9 +44,13 @@ class a65_token :
 			__in const a65_token &other
 			);
 
+		size_t column(void) const;
+
+		uint32_t file(void) const;
+
 		size_t line(void) const;
 
-		std::string literal(void) const;
+		const std::string &literal(void) const;
 
 		std::string literal_formatted(void) const;
 
@@ -57,7 +62,7 @@ class a65_token :
 
 		int mode(void) const;
 
-		std::string path(void) const;
+		const std::string &path(void) const;
 
 		uint16_t scalar(void) const;
 
@@ -71,6 +76,12 @@ class a65_token :
 			__in const std::string &literal
 			);
 
+		void set_location(
+			__in uint32_t file,
+			__in size_t line,
+			__in size_t column
+			);
+
 		void set_metadata(
 			__in const std::string &path
 			);
@@ -90,19 +101,25 @@ class a65_token :
 
 		int subtype(void) const;
 
+		uint32_t symbol(void) const;
+
 		virtual std::string to_string(void) const;
 
 		int type(void) const;
 
 	protected:
 
-		size_t m_line;
+		uint32_t m_column;
 
-		std::string m_literal;
+		uint32_t m_file;
 
-		int m_mode;
+		a65_intern *m_intern;
+
+		uint32_t m_line;
 
-		std::string m_path;
+		uint32_t m_literal;
+
+		int m_mode;
 
 		uint16_t m_scalar;
 
@@ -403,154 +403,170 @@ static const std::map<std::string, int> A65_TOKEN_COMMAND_MODE_MAP = {
 #define A65_IS_TOKEN_COMMAND_MODE(_STRING_) \
 	(A65_TOKEN_COMMAND_MODE_MAP.find(_STRING_) != A65_TOKEN_COMMAND_MODE_MAP.end())
 
-static const std::set<int> A65_TOKEN_COMMAND_ABSOLUTE_SET = {
-	A65_TOKEN_COMMAND_ADC, A65_TOKEN_COMMAND_AND, A65_TOKEN_COMMAND_ASL, A65_TOKEN_COMMAND_BIT,
-	A65_TOKEN_COMMAND_CMP, A65_TOKEN_COMMAND_CPX, A65_TOKEN_COMMAND_CPY, A65_TOKEN_COMMAND_DEC,
-	A65_TOKEN_COMMAND_EOR, A65_TOKEN_COMMAND_INC, A65_TOKEN_COMMAND_JMP, A65_TOKEN_COMMAND_JSR,
-	A65_TOKEN_COMMAND_LDA, A65_TOKEN_COMMAND_LDX, A65_TOKEN_COMMAND_LDY, A65_TOKEN_COMMAND_LSR,
-	A65_TOKEN_COMMAND_ORA, A65_TOKEN_COMMAND_ROL, A65_TOKEN_COMMAND_ROR, A65_TOKEN_COMMAND_SBC,
-	A65_TOKEN_COMMAND_STA, A65_TOKEN_COMMAND_STX, A65_TOKEN_COMMAND_STY, A65_TOKEN_COMMAND_STZ,
-	A65_TOKEN_COMMAND_TRB, A65_TOKEN_COMMAND_TSB,
-	};
+typedef struct {
+	uint8_t opcode;
+	uint8_t length;
+	uint8_t cycle;
+} a65_token_command_encoding_t;
+
+static constexpr a65_token_command_encoding_t A65_TOKEN_COMMAND_ENCODING[A65_TOKEN_COMMAND_MAX + 1][A65_TOKEN_COMMAND_MODE_MAX + 1] = {
+	{{0x6d, 3, 4}, {}, {0x7d, 3, 4}, {0x79, 3, 4}, {}, {}, {0x69, 2, 2}, {}, {}, {0x65, 2, 3}, {0x61, 2, 6}, {0x75, 2, 4}, {}, {0x72, 2, 5}, {0x71, 2, 5}},
+	{{0x2d, 3, 4}, {}, {0x3d, 3, 4}, {0x39, 3, 4}, {}, {}, {0x29, 2, 2}, {}, {}, {0x25, 2, 3}, {0x21, 2, 6}, {0x35, 2, 4}, {}, {0x32, 2, 5}, {0x31, 2, 5}},
+	{{0x0e, 3, 6}, {}, {0x1e, 3, 6}, {}, {}, {0x0a, 1, 2}, {}, {}, {}, {0x06, 2, 5}, {}, {0x16, 2, 6}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0x0f, 3, 5}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0x1f, 3, 5}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0x2f, 3, 5}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0x3f, 3, 5}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0x4f, 3, 5}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0x5f, 3, 5}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0x6f, 3, 5}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0x7f, 3, 5}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0x8f, 3, 5}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0x9f, 3, 5}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0xaf, 3, 5}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0xbf, 3, 5}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0xcf, 3, 5}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0xdf, 3, 5}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0xef, 3, 5}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0xff, 3, 5}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0x90, 2, 2}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0xb0, 2, 2}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0xf0, 2, 2}, {}, {}, {}, {}, {}, {}},
+	{{0x2c, 3, 4}, {}, {0x3c, 3, 4}, {}, {}, {}, {0x89, 2, 2}, {}, {}, {0x24, 2, 3}, {}, {0x34, 2, 4}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0x30, 2, 2}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0xd0, 2, 2}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0x10, 2, 2}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0x80, 2, 3}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x00, 2, 7}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0x50, 2, 2}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {0x70, 2, 2}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x18, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0xd8, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x58, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0xb8, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}},
+	{{0xcd, 3, 4}, {}, {0xdd, 3, 4}, {0xd9, 3, 4}, {}, {}, {0xc9, 2, 2}, {}, {}, {0xc5, 2, 3}, {0xc1, 2, 6}, {0xd5, 2, 4}, {}, {0xd2, 2, 5}, {0xd1, 2, 5}},
+	{{0xec, 3, 4}, {}, {}, {}, {}, {}, {0xe0, 2, 2}, {}, {}, {0xe4, 2, 3}, {}, {}, {}, {}, {}},
+	{{0xcc, 3, 4}, {}, {}, {}, {}, {}, {0xc0, 2, 2}, {}, {}, {0xc4, 2, 3}, {}, {}, {}, {}, {}},
+	{{0xce, 3, 6}, {}, {0xde, 3, 7}, {}, {}, {0x3a, 1, 2}, {}, {}, {}, {0xc6, 2, 5}, {}, {0xd6, 2, 6}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0xca, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x88, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{0x4d, 3, 4}, {}, {0x5d, 3, 4}, {0x59, 3, 4}, {}, {}, {0x49, 2, 2}, {}, {}, {0x45, 2, 3}, {0x41, 2, 6}, {0x55, 2, 4}, {}, {0x52, 2, 5}, {0x51, 2, 5}},
+	{{0xee, 3, 6}, {}, {0xfe, 3, 7}, {}, {}, {0x1a, 1, 2}, {}, {}, {}, {0xe6, 2, 5}, {}, {0xf6, 2, 6}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0xe8, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0xc8, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{0x4c, 3, 3}, {0x7c, 3, 6}, {}, {}, {0x6c, 3, 6}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}},
+	{{0x20, 3, 6}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}},
+	{{0xad, 3, 4}, {}, {0xbd, 3, 4}, {0xb9, 3, 4}, {}, {}, {0xa9, 2, 2}, {}, {}, {0xa5, 2, 3}, {0xa1, 2, 6}, {0xb5, 2, 4}, {}, {0xb2, 2, 5}, {0xb1, 2, 5}},
+	{{0xae, 3, 4}, {}, {}, {0xbe, 3, 4}, {}, {}, {0xa2, 2, 2}, {}, {}, {0xa6, 2, 3}, {}, {}, {0xb6, 2, 4}, {}, {}},
+	{{0xac, 3, 4}, {}, {0xbc, 3, 4}, {}, {}, {}, {0xa0, 2, 2}, {}, {}, {0xa4, 2, 3}, {}, {0xb4, 2, 4}, {}, {}, {}},
+	{{0x4e, 3, 6}, {}, {0x5e, 3, 6}, {}, {}, {0x4a, 1, 2}, {}, {}, {}, {0x46, 2, 5}, {}, {0x56, 2, 6}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0xea, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{0x0d, 3, 4}, {}, {0x1d, 3, 4}, {0x19, 3, 4}, {}, {}, {0x09, 2, 2}, {}, {}, {0x05, 2, 3}, {0x01, 2, 6}, {0x15, 2, 4}, {}, {0x12, 2, 5}, {0x11, 2, 5}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x48, 1, 3}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x08, 1, 3}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0xda, 1, 3}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x5a, 1, 3}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x68, 1, 4}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x28, 1, 4}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0xfa, 1, 4}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x7a, 1, 4}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {0x07, 2, 5}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {0x17, 2, 5}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {0x27, 2, 5}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {0x37, 2, 5}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {0x47, 2, 5}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {0x57, 2, 5}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {0x67, 2, 5}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {0x77, 2, 5}, {}, {}, {}, {}, {}},
+	{{0x2e, 3, 6}, {}, {0x3e, 3, 6}, {}, {}, {0x2a, 1, 2}, {}, {}, {}, {0x26, 2, 5}, {}, {0x36, 2, 6}, {}, {}, {}},
+	{{0x6e, 3, 6}, {}, {0x7e, 3, 6}, {}, {}, {0x6a, 1, 2}, {}, {}, {}, {0x66, 2, 5}, {}, {0x76, 2, 6}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x40, 1, 6}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x60, 1, 6}, {}, {}, {}, {}, {}, {}, {}},
+	{{0xed, 3, 4}, {}, {0xfd, 3, 4}, {0xf9, 3, 4}, {}, {}, {0xe9, 2, 2}, {}, {}, {0xe5, 2, 3}, {0xe1, 2, 6}, {0xf5, 2, 4}, {}, {0xf2, 2, 5}, {0xf1, 2, 5}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x38, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0xf8, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x78, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {0x87, 2, 5}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {0x97, 2, 5}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {0xa7, 2, 5}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {0xb7, 2, 5}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {0xc7, 2, 5}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {0xd7, 2, 5}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {0xe7, 2, 5}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {}, {}, {0xf7, 2, 5}, {}, {}, {}, {}, {}},
+	{{0x8d, 3, 4}, {}, {0x9d, 3, 5}, {0x99, 3, 5}, {}, {}, {}, {}, {}, {0x85, 2, 3}, {0x81, 2, 6}, {0x95, 2, 4}, {}, {0x92, 2, 5}, {0x91, 2, 6}},
+	{{}, {}, {}, {}, {}, {}, {}, {0xdb, 1, 3}, {}, {}, {}, {}, {}, {}, {}},
+	{{0x8e, 3, 4}, {}, {}, {}, {}, {}, {}, {}, {}, {0x86, 2, 3}, {}, {}, {0x96, 2, 4}, {}, {}},
+	{{0x8c, 3, 4}, {}, {}, {}, {}, {}, {}, {}, {}, {0x84, 2, 3}, {}, {0x94, 2, 4}, {}, {}, {}},
+	{{0x9c, 3, 4}, {}, {0x9e, 3, 5}, {}, {}, {}, {}, {}, {}, {0x64, 2, 3}, {}, {0x74, 2, 4}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0xaa, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0xa8, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{0x1c, 3, 6}, {}, {}, {}, {}, {}, {}, {}, {}, {0x14, 2, 5}, {}, {}, {}, {}, {}},
+	{{0x0c, 3, 6}, {}, {}, {}, {}, {}, {}, {}, {}, {0x04, 2, 5}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0xba, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x8a, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x9a, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0x98, 1, 2}, {}, {}, {}, {}, {}, {}, {}},
+	{{}, {}, {}, {}, {}, {}, {}, {0xcb, 1, 3}, {}, {}, {}, {}, {}, {}, {}},
+	};
+
+#define A65_TOKEN_COMMAND_CYCLE(_TYPE_, _MODE_) \
+	A65_TOKEN_COMMAND_ENCODING[_TYPE_][_MODE_].cycle
+
+#define A65_TOKEN_COMMAND_LENGTH(_TYPE_, _MODE_) \
+	A65_TOKEN_COMMAND_ENCODING[_TYPE_][_MODE_].length
+
+#define A65_TOKEN_COMMAND_OPCODE(_TYPE_, _MODE_) \
+	A65_TOKEN_COMMAND_ENCODING[_TYPE_][_MODE_].opcode
+
+#define A65_IS_TOKEN_COMMAND_ENCODED(_TYPE_, _MODE_) \
+	(A65_TOKEN_COMMAND_LENGTH(_TYPE_, _MODE_) != 0)
 
 #define A65_IS_TOKEN_COMMAND_ABSOLUTE(_TYPE_) \
-	(A65_TOKEN_COMMAND_ABSOLUTE_SET.find(_TYPE_) != A65_TOKEN_COMMAND_ABSOLUTE_SET.end())
-
-static const std::set<int> A65_TOKEN_COMMAND_ABSOLUTE_INDEX_INDIRECT_SET = {
-	A65_TOKEN_COMMAND_JMP,
-	};
+	A65_IS_TOKEN_COMMAND_ENCODED(_TYPE_, A65_TOKEN_COMMAND_MODE_ABSOLUTE)
 
 #define A65_IS_TOKEN_COMMAND_ABSOLUTE_INDEX_INDIRECT(_TYPE_) \
-	(A65_TOKEN_COMMAND_ABSOLUTE_INDEX_INDIRECT_SET.find(_TYPE_) != A65_TOKEN_COMMAND_ABSOLUTE_INDEX_INDIRECT_SET.end())
-
-static const std::set<int> A65_TOKEN_COMMAND_ABSOLUTE_INDEX_X_SET = {
-	A65_TOKEN_COMMAND_ADC, A65_TOKEN_COMMAND_AND, A65_TOKEN_COMMAND_ASL, A65_TOKEN_COMMAND_BIT,
-	A65_TOKEN_COMMAND_CMP, A65_TOKEN_COMMAND_DEC, A65_TOKEN_COMMAND_EOR, A65_TOKEN_COMMAND_INC,
-	A65_TOKEN_COMMAND_LDA, A65_TOKEN_COMMAND_LDY, A65_TOKEN_COMMAND_LSR, A65_TOKEN_COMMAND_ORA,
-	A65_TOKEN_COMMAND_ROL, A65_TOKEN_COMMAND_ROR, A65_TOKEN_COMMAND_SBC, A65_TOKEN_COMMAND_STA,
-	A65_TOKEN_COMMAND_STZ,
-	};
+	A65_IS_TOKEN_COMMAND_ENCODED(_TYPE_, A65_TOKEN_COMMAND_MODE_ABSOLUTE_INDEX_INDIRECT)
 
 #define A65_IS_TOKEN_COMMAND_ABSOLUTE_INDEX_X(_TYPE_) \
-	(A65_TOKEN_COMMAND_ABSOLUTE_INDEX_X_SET.find(_TYPE_) != A65_TOKEN_COMMAND_ABSOLUTE_INDEX_X_SET.end())
-
-static const std::set<int> A65_TOKEN_COMMAND_ABSOLUTE_INDEX_Y_SET = {
-	A65_TOKEN_COMMAND_ADC, A65_TOKEN_COMMAND_AND, A65_TOKEN_COMMAND_CMP, A65_TOKEN_COMMAND_EOR,
-	A65_TOKEN_COMMAND_LDA, A65_TOKEN_COMMAND_LDX, A65_TOKEN_COMMAND_ORA, A65_TOKEN_COMMAND_SBC,
-	A65_TOKEN_COMMAND_STA,
-	};
+	A65_IS_TOKEN_COMMAND_ENCODED(_TYPE_, A65_TOKEN_COMMAND_MODE_ABSOLUTE_INDEX_X)
 
 #define A65_IS_TOKEN_COMMAND_ABSOLUTE_INDEX_Y(_TYPE_) \
-	(A65_TOKEN_COMMAND_ABSOLUTE_INDEX_Y_SET.find(_TYPE_) != A65_TOKEN_COMMAND_ABSOLUTE_INDEX_Y_SET.end())
-
-static const std::set<int> A65_TOKEN_COMMAND_ABSOLUTE_INDIRECT_SET = {
-	A65_TOKEN_COMMAND_JMP,
-	};
+	A65_IS_TOKEN_COMMAND_ENCODED(_TYPE_, A65_TOKEN_COMMAND_MODE_ABSOLUTE_INDEX_Y)
 
 #define A65_IS_TOKEN_COMMAND_ABSOLUTE_INDIRECT(_TYPE_) \
-	(A65_TOKEN_COMMAND_ABSOLUTE_INDIRECT_SET.find(_TYPE_) != A65_TOKEN_COMMAND_ABSOLUTE_INDIRECT_SET.end())
-
-static const std::set<int> A65_TOKEN_COMMAND_ACCUMULATOR_SET = {
-	A65_TOKEN_COMMAND_ASL, A65_TOKEN_COMMAND_DEC, A65_TOKEN_COMMAND_INC, A65_TOKEN_COMMAND_LSR,
-	A65_TOKEN_COMMAND_ROL, A65_TOKEN_COMMAND_ROR,
-	};
+	A65_IS_TOKEN_COMMAND_ENCODED(_TYPE_, A65_TOKEN_COMMAND_MODE_ABSOLUTE_INDIRECT)
 
 #define A65_IS_TOKEN_COMMAND_ACCUMULATOR(_TYPE_) \
-	(A65_TOKEN_COMMAND_ACCUMULATOR_SET.find(_TYPE_) != A65_TOKEN_COMMAND_ACCUMULATOR_SET.end())
-
-static const std::set<int> A65_TOKEN_COMMAND_IMMEDIATE_SET = {
-	A65_TOKEN_COMMAND_ADC, A65_TOKEN_COMMAND_AND, A65_TOKEN_COMMAND_BIT, A65_TOKEN_COMMAND_CMP,
-	A65_TOKEN_COMMAND_CPX, A65_TOKEN_COMMAND_CPY, A65_TOKEN_COMMAND_EOR, A65_TOKEN_COMMAND_LDA,
-	A65_TOKEN_COMMAND_LDX, A65_TOKEN_COMMAND_LDY, A65_TOKEN_COMMAND_ORA, A65_TOKEN_COMMAND_SBC,
-	};
+	A65_IS_TOKEN_COMMAND_ENCODED(_TYPE_, A65_TOKEN_COMMAND_MODE_ACCUMULATOR)
 
 #define A65_IS_TOKEN_COMMAND_IMMEDIATE(_TYPE_) \
-	(A65_TOKEN_COMMAND_IMMEDIATE_SET.find(_TYPE_) != A65_TOKEN_COMMAND_IMMEDIATE_SET.end())
-
-static const std::set<int> A65_TOKEN_COMMAND_IMPLIED_SET = {
-	A65_TOKEN_COMMAND_BRK, A65_TOKEN_COMMAND_CLC, A65_TOKEN_COMMAND_CLD, A65_TOKEN_COMMAND_CLI,
-	A65_TOKEN_COMMAND_CLV, A65_TOKEN_COMMAND_DEX, A65_TOKEN_COMMAND_DEY, A65_TOKEN_COMMAND_INX,
-	A65_TOKEN_COMMAND_INY, A65_TOKEN_COMMAND_NOP, A65_TOKEN_COMMAND_PHA, A65_TOKEN_COMMAND_PHP,
-	A65_TOKEN_COMMAND_PHX, A65_TOKEN_COMMAND_PHY, A65_TOKEN_COMMAND_PLA, A65_TOKEN_COMMAND_PLP,
-	A65_TOKEN_COMMAND_PLX, A65_TOKEN_COMMAND_PLY, A65_TOKEN_COMMAND_RTI, A65_TOKEN_COMMAND_RTS,
-	A65_TOKEN_COMMAND_SEC, A65_TOKEN_COMMAND_SED, A65_TOKEN_COMMAND_SEI, A65_TOKEN_COMMAND_STP,
-	A65_TOKEN_COMMAND_TAX, A65_TOKEN_COMMAND_TAY, A65_TOKEN_COMMAND_TSX, A65_TOKEN_COMMAND_TXA,
-	A65_TOKEN_COMMAND_TXS, A65_TOKEN_COMMAND_TYA, A65_TOKEN_COMMAND_WAI,
-	};
+	A65_IS_TOKEN_COMMAND_ENCODED(_TYPE_, A65_TOKEN_COMMAND_MODE_IMMEDIATE)
 
 #define A65_IS_TOKEN_COMMAND_IMPLIED(_TYPE_) \
-	(A65_TOKEN_COMMAND_IMPLIED_SET.find(_TYPE_) != A65_TOKEN_COMMAND_IMPLIED_SET.end())
-
-static const std::set<int> A65_TOKEN_COMMAND_RELATIVE_SET = {
-	A65_TOKEN_COMMAND_BBR0, A65_TOKEN_COMMAND_BBR1, A65_TOKEN_COMMAND_BBR2, A65_TOKEN_COMMAND_BBR3,
-	A65_TOKEN_COMMAND_BBR4, A65_TOKEN_COMMAND_BBR5, A65_TOKEN_COMMAND_BBR6, A65_TOKEN_COMMAND_BBR7,
-	A65_TOKEN_COMMAND_BBS0, A65_TOKEN_COMMAND_BBS1, A65_TOKEN_COMMAND_BBS2, A65_TOKEN_COMMAND_BBS3,
-	A65_TOKEN_COMMAND_BBS4, A65_TOKEN_COMMAND_BBS5, A65_TOKEN_COMMAND_BBS6, A65_TOKEN_COMMAND_BBS7,
-	A65_TOKEN_COMMAND_BCC, A65_TOKEN_COMMAND_BCS, A65_TOKEN_COMMAND_BEQ, A65_TOKEN_COMMAND_BMI,
-	A65_TOKEN_COMMAND_BNE, A65_TOKEN_COMMAND_BPL, A65_TOKEN_COMMAND_BRA, A65_TOKEN_COMMAND_BVC,
-	A65_TOKEN_COMMAND_BVS,
-	};
+	A65_IS_TOKEN_COMMAND_ENCODED(_TYPE_, A65_TOKEN_COMMAND_MODE_IMPLIED)
 
 #define A65_IS_TOKEN_COMMAND_RELATIVE(_TYPE_) \
-	(A65_TOKEN_COMMAND_RELATIVE_SET.find(_TYPE_) != A65_TOKEN_COMMAND_RELATIVE_SET.end())
-
-static const std::set<int> A65_TOKEN_COMMAND_ZEROPAGE_SET = {
-	A65_TOKEN_COMMAND_ADC, A65_TOKEN_COMMAND_AND, A65_TOKEN_COMMAND_ASL, A65_TOKEN_COMMAND_BIT,
-	A65_TOKEN_COMMAND_CMP, A65_TOKEN_COMMAND_CPX, A65_TOKEN_COMMAND_CPY, A65_TOKEN_COMMAND_DEC,
-	A65_TOKEN_COMMAND_EOR, A65_TOKEN_COMMAND_INC, A65_TOKEN_COMMAND_LDA, A65_TOKEN_COMMAND_LDX,
-	A65_TOKEN_COMMAND_LDY, A65_TOKEN_COMMAND_LSR, A65_TOKEN_COMMAND_ORA, A65_TOKEN_COMMAND_RMB0,
-	A65_TOKEN_COMMAND_RMB1, A65_TOKEN_COMMAND_RMB2, A65_TOKEN_COMMAND_RMB3, A65_TOKEN_COMMAND_RMB4,
-	A65_TOKEN_COMMAND_RMB5, A65_TOKEN_COMMAND_RMB6, A65_TOKEN_COMMAND_RMB7, A65_TOKEN_COMMAND_ROL,
-	A65_TOKEN_COMMAND_ROR, A65_TOKEN_COMMAND_SBC, A65_TOKEN_COMMAND_SMB0, A65_TOKEN_COMMAND_SMB1,
-	A65_TOKEN_COMMAND_SMB2, A65_TOKEN_COMMAND_SMB3, A65_TOKEN_COMMAND_SMB4, A65_TOKEN_COMMAND_SMB5,
-	A65_TOKEN_COMMAND_SMB6, A65_TOKEN_COMMAND_SMB7, A65_TOKEN_COMMAND_STA, A65_TOKEN_COMMAND_STX,
-	A65_TOKEN_COMMAND_STY, A65_TOKEN_COMMAND_STZ, A65_TOKEN_COMMAND_TRB, A65_TOKEN_COMMAND_TSB,
-	};
+	A65_IS_TOKEN_COMMAND_ENCODED(_TYPE_, A65_TOKEN_COMMAND_MODE_RELATIVE)
 
 #define A65_IS_TOKEN_COMMAND_ZEROPAGE(_TYPE_) \
-	(A65_TOKEN_COMMAND_ZEROPAGE_SET.find(_TYPE_) != A65_TOKEN_COMMAND_ZEROPAGE_SET.end())
-
-static const std::set<int> A65_TOKEN_COMMAND_ZEROPAGE_INDEX_INDIRECT_SET = {
-	A65_TOKEN_COMMAND_ADC, A65_TOKEN_COMMAND_AND, A65_TOKEN_COMMAND_CMP, A65_TOKEN_COMMAND_EOR,
-	A65_TOKEN_COMMAND_LDA, A65_TOKEN_COMMAND_ORA, A65_TOKEN_COMMAND_SBC, A65_TOKEN_COMMAND_STA,
-	};
+	A65_IS_TOKEN_COMMAND_ENCODED(_TYPE_, A65_TOKEN_COMMAND_MODE_ZEROPAGE)
 
 #define A65_IS_TOKEN_COMMAND_ZEROPAGE_INDEX_INDIRECT(_TYPE_) \
-	(A65_TOKEN_COMMAND_ZEROPAGE_INDEX_INDIRECT_SET.find(_TYPE_) != A65_TOKEN_COMMAND_ZEROPAGE_INDEX_INDIRECT_SET.end())
-
-static const std::set<int> A65_TOKEN_COMMAND_ZEROPAGE_INDEX_X_SET = {
-	A65_TOKEN_COMMAND_ADC, A65_TOKEN_COMMAND_AND, A65_TOKEN_COMMAND_ASL, A65_TOKEN_COMMAND_BIT,
-	A65_TOKEN_COMMAND_CMP, A65_TOKEN_COMMAND_DEC, A65_TOKEN_COMMAND_EOR, A65_TOKEN_COMMAND_INC,
-	A65_TOKEN_COMMAND_LDA, A65_TOKEN_COMMAND_LDY, A65_TOKEN_COMMAND_LSR, A65_TOKEN_COMMAND_ORA,
-	A65_TOKEN_COMMAND_ROL, A65_TOKEN_COMMAND_ROR, A65_TOKEN_COMMAND_SBC, A65_TOKEN_COMMAND_STA,
-	A65_TOKEN_COMMAND_STY, A65_TOKEN_COMMAND_STZ,
-	};
+	A65_IS_TOKEN_COMMAND_ENCODED(_TYPE_, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDEX_INDIRECT)
 
 #define A65_IS_TOKEN_COMMAND_ZEROPAGE_INDEX_X(_TYPE_) \
-	(A65_TOKEN_COMMAND_ZEROPAGE_INDEX_X_SET.find(_TYPE_) != A65_TOKEN_COMMAND_ZEROPAGE_INDEX_X_SET.end())
-
-static const std::set<int> A65_TOKEN_COMMAND_ZEROPAGE_INDEX_Y_SET = {
-	A65_TOKEN_COMMAND_LDX, A65_TOKEN_COMMAND_STX,
-	};
+	A65_IS_TOKEN_COMMAND_ENCODED(_TYPE_, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDEX_X)
 
 #define A65_IS_TOKEN_COMMAND_ZEROPAGE_INDEX_Y(_TYPE_) \
-	(A65_TOKEN_COMMAND_ZEROPAGE_INDEX_Y_SET.find(_TYPE_) != A65_TOKEN_COMMAND_ZEROPAGE_INDEX_Y_SET.end())
-
-static const std::set<int> A65_TOKEN_COMMAND_ZEROPAGE_INDIRECT_SET = {
-	A65_TOKEN_COMMAND_ADC, A65_TOKEN_COMMAND_AND, A65_TOKEN_COMMAND_CMP, A65_TOKEN_COMMAND_EOR,
-	A65_TOKEN_COMMAND_LDA, A65_TOKEN_COMMAND_ORA, A65_TOKEN_COMMAND_SBC, A65_TOKEN_COMMAND_STA,
-	};
+	A65_IS_TOKEN_COMMAND_ENCODED(_TYPE_, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDEX_Y)
 
 #define A65_IS_TOKEN_COMMAND_ZEROPAGE_INDIRECT(_TYPE_) \
-	(A65_TOKEN_COMMAND_ZEROPAGE_INDIRECT_SET.find(_TYPE_) != A65_TOKEN_COMMAND_ZEROPAGE_INDIRECT_SET.end())
-
-static const std::set<int> A65_TOKEN_COMMAND_ZEROPAGE_INDIRECT_INDEX_SET = {
-	A65_TOKEN_COMMAND_ADC, A65_TOKEN_COMMAND_AND, A65_TOKEN_COMMAND_CMP, A65_TOKEN_COMMAND_EOR,
-	A65_TOKEN_COMMAND_LDA, A65_TOKEN_COMMAND_ORA, A65_TOKEN_COMMAND_SBC, A65_TOKEN_COMMAND_STA,
-	};
+	A65_IS_TOKEN_COMMAND_ENCODED(_TYPE_, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDIRECT)
 
 #define A65_IS_TOKEN_COMMAND_ZEROPAGE_INDIRECT_INDEX(_TYPE_) \
-	(A65_TOKEN_COMMAND_ZEROPAGE_INDIRECT_INDEX_SET.find(_TYPE_) != A65_TOKEN_COMMAND_ZEROPAGE_INDIRECT_INDEX_SET.end())
+	A65_IS_TOKEN_COMMAND_ENCODED(_TYPE_, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDIRECT_INDEX)
 
 enum {
 	A65_TOKEN_CONSTANT_FALSE = 0,
@@ -658,12 +674,13 @@ enum {
 	A65_TOKEN_PRAGMA_INCLUDE_BINARY = 0,
 	A65_TOKEN_PRAGMA_INCLUDE_SOURCE,
 	A65_TOKEN_PRAGMA_METADATA,
+	A65_TOKEN_PRAGMA_ONCE,
 };
 
-#define A65_TOKEN_PRAGMA_MAX A65_TOKEN_PRAGMA_METADATA
+#define A65_TOKEN_PRAGMA_MAX A65_TOKEN_PRAGMA_ONCE
 
 static const std::string A65_TOKEN_PRAGMA_STR[] = {
-	"@incb", "@inc", "@meta",
+	"@incb", "@inc", "@meta", "@once",
 	};
 
 #define A65_TOKEN_PRAGMA_STRING(_TYPE_) \
@@ -674,6 +691,7 @@ static const std::map<std::string, int> A65_TOKEN_PRAGMA_MAP = {
 	std::make_pair(A65_TOKEN_PRAGMA_STRING(A65_TOKEN_PRAGMA_INCLUDE_BINARY), A65_TOKEN_PRAGMA_INCLUDE_BINARY),
 	std::make_pair(A65_TOKEN_PRAGMA_STRING(A65_TOKEN_PRAGMA_INCLUDE_SOURCE), A65_TOKEN_PRAGMA_INCLUDE_SOURCE),
 	std::make_pair(A65_TOKEN_PRAGMA_STRING(A65_TOKEN_PRAGMA_METADATA), A65_TOKEN_PRAGMA_METADATA),
+	std::make_pair(A65_TOKEN_PRAGMA_STRING(A65_TOKEN_PRAGMA_ONCE), A65_TOKEN_PRAGMA_ONCE),
 	};
 
 #define A65_TOKEN_PRAGMA_ID(_STRING_) \
@@ -748,6 +766,9 @@ static const std::string A65_TOKEN_SYMBOL_STR[] = {
 	"==", ">", ">=", "<", "<=", "!=", ")", "(", ",", "~", "!",
 	};
 
+#define A65_IS_TOKEN_SYMBOL_DIVISION(_TYPE_) \
+	(((_TYPE_) == A65_TOKEN_SYMBOL_ARITHMETIC_DIVIDE) || ((_TYPE_) == A65_TOKEN_SYMBOL_ARITHMETIC_MODULUS))
+
 #define A65_TOKEN_SYMBOL_STRING(_TYPE_) \
 	(((_TYPE_) > A65_TOKEN_SYMBOL_MAX) ? A65_STRING_UNKNOWN : \
 		A65_STRING_CHECK(A65_TOKEN_SYMBOL_STR[_TYPE_]))
@@ -84,7 +84,7 @@ class a65_tree :
 		void move_root(void);
 
 		a65_node &node(
-			__in_opt uint32_t id = A65_UUID_INVALID
+			__in_opt uint32_t id = A65_NODE_INVALID
 			);
 
 		void remove_child(
@@ -103,15 +103,27 @@ class a65_tree :
 
 	protected:
 
-		std::map<uint32_t, a65_node>::iterator find(
+		size_t count(
+			__in uint32_t id
+			) const;
+
+		a65_node &find(
 			__in uint32_t id
 			);
 
-		void remove(void);
+		size_t insert(
+			__in uint32_t parent,
+			__in uint32_t id,
+			__in size_t position
+			);
 
 		uint32_t m_node;
 
-		std::map<uint32_t, a65_node> m_node_map;
+		std::vector<uint32_t> m_node_child;
+
+		size_t m_node_count;
+
+		std::vector<a65_node> m_node_pool;
 
 		uint32_t m_node_root;
 
@@ -25,6 +25,11 @@ class a65_utility {
 
 	public:
 
+		static void copy_file(
+			__in const std::string &source,
+			__in const std::string &destination
+			);
+
 		static std::string data_as_string(
 			__in const std::vector<uint8_t> &data,
 			__in_opt uint16_t origin = 0
@@ -46,6 +51,15 @@ class a65_utility {
 			__inout std::string &name
 			);
 
+		static bool has_file(
+			__in const std::string &path
+			);
+
+		static uint64_t hash(
+			__in const std::string &data,
+			__in_opt uint64_t seed = 0
+			);
+
 		static size_t read_file(
 			__in const std::string &path,
 			__inout std::string &data
@@ -61,6 +61,23 @@
 #define A65_DEBUG_PRINT(_LEVEL_, _PREFIX_, _MESSAGE_, _FILE_, _FUNCTION_, _LINE_, _FORMAT_, ...)
 #endif // NDEBUG
 
+#define A65_HASH_PRIME_1 0x9e3779b185ebca87ULL
+#define A65_HASH_PRIME_2 0xc2b2ae3d27d4eb4fULL
+#define A65_HASH_PRIME_3 0x165667b19e3779f9ULL
+#define A65_HASH_PRIME_4 0x85ebca77c2b2ae63ULL
+#define A65_HASH_PRIME_5 0x27d4eb2f165667c5ULL
+
+#define A65_HASH_ROTATE(_VALUE_, _SHIFT_) \
+	(((_VALUE_) << (_SHIFT_)) | ((_VALUE_) >> (64 - (_SHIFT_))))
+
+#define A65_HASH_ROUND(_ACCUMULATOR_, _INPUT_) \
+	(A65_HASH_ROTATE((_ACCUMULATOR_) + ((_INPUT_) * A65_HASH_PRIME_2), 31) * A65_HASH_PRIME_1)
+
+#define A65_HASH_MERGE(_ACCUMULATOR_, _VALUE_) \
+	((((_ACCUMULATOR_) ^ A65_HASH_ROUND(0, _VALUE_)) * A65_HASH_PRIME_1) + A65_HASH_PRIME_4)
+
+#define A65_HASH_STRIPE_LENGTH 32
+
 #define A65_THROW_EXCEPTION(_MESSAGE_) \
 	A65_THROW_EXCEPTION_INFO(_MESSAGE_, "", "")
 #define A65_THROW_EXCEPTION_INFO(_MESSAGE_, _FORMAT_, ...) \
@@ -25,8 +25,14 @@ class a65_uuid {
 
 	public:
 
+		a65_uuid(void);
+
 		~a65_uuid(void);
 
+		static a65_uuid *bind(
+			__in_opt a65_uuid *context = nullptr
+			);
+
 		bool contains(
 			__in uint32_t id
 			) const;
@@ -45,8 +51,6 @@ class a65_uuid {
 
 	protected:
 
-		a65_uuid(void);
-
 		a65_uuid(
 			__in const a65_uuid &other
 			) = delete;
@@ -55,15 +59,19 @@ class a65_uuid {
 			__in const a65_uuid &other
 			) = delete;
 
-		std::map<uint32_t, size_t>::iterator find(
+		std::atomic<uint32_t> &find(
+			__in uint32_t id
+			) const;
+
+		a65_uuid_page_t *page(
 			__in uint32_t id
 			);
 
-		uint32_t m_next;
+		std::atomic<uint32_t> m_next;
 
-		std::map<uint32_t, size_t> m_reference;
+		std::atomic<a65_uuid_page_t *> m_page[A65_UUID_PAGE_COUNT];
 
-		std::set<uint32_t> m_surplus;
+		std::atomic<uint64_t> m_surplus;
 };
 
 #endif // A65_UUID_H_
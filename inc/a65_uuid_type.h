@@ -19,10 +19,36 @@
 #ifndef A65_UUID_TYPE_H_
 #define A65_UUID_TYPE_H_
 
+#include <atomic>
 #include "./a65_define.h"
 
 #define A65_UUID_INVALID 0
 
+#define A65_UUID_PAGE_COUNT 0x1000
+#define A65_UUID_PAGE_LENGTH 0x1000
+
+#define A65_UUID_MAX ((A65_UUID_PAGE_COUNT * A65_UUID_PAGE_LENGTH) - 1)
+
+#define A65_UUID_PAGE(_ID_) \
+	((_ID_) / A65_UUID_PAGE_LENGTH)
+
+#define A65_UUID_PAGE_OFFSET(_ID_) \
+	((_ID_) % A65_UUID_PAGE_LENGTH)
+
 #define A65_UUID_REFERENCE_START 1
 
+#define A65_UUID_SURPLUS(_TAG_, _ID_) \
+	((((uint64_t) (_TAG_)) << 32) | (uint32_t) (_ID_))
+
+#define A65_UUID_SURPLUS_ID(_SURPLUS_) \
+	((uint32_t) (_SURPLUS_))
+
+#define A65_UUID_SURPLUS_TAG(_SURPLUS_) \
+	((uint32_t) ((_SURPLUS_) >> 32))
+
+typedef struct {
+	std::atomic<uint32_t> reference[A65_UUID_PAGE_LENGTH];
+	std::atomic<uint32_t> surplus[A65_UUID_PAGE_LENGTH];
+} a65_uuid_page_t;
+
 #endif // A65_UUID_TYPE_H_
@@ -18,11 +18,62 @@
 
 #include "../inc/a65.h"
 #include "../inc/a65_assembler.h"
+#include "../inc/a65_intern.h"
 #include "../inc/a65_utility.h"
+#include "../inc/a65_uuid.h"
 
-static std::string g_error;
+struct a65_context_s {
+	std::string cache;
+	std::string depend;
+	std::string error;
+	std::vector<std::string> include;
+	int option[A65_OPTION_MAX + 1];
+	std::string output;
+	unsigned long statistic[A65_STATISTIC_MAX + 1];
+};
 
-static std::string g_output;
+static thread_local a65_context_t g_context;
+
+int
+a65_add_include_path(
+	__in const char *path
+	)
+{
+	int result;
+
+	A65_DEBUG_ENTRY_INFO("Path=%p", path);
+
+	result = a65_add_include_path_r(&g_context, path);
+
+	A65_DEBUG_EXIT_INFO("Result=%i(%x)", result, result);
+	return result;
+}
+
+int
+a65_add_include_path_r(
+	__inout a65_context_t *context,
+	__in const char *path
+	)
+{
+	int result = EXIT_SUCCESS;
+
+	A65_DEBUG_ENTRY_INFO("Context=%p, Path=%p", context, path);
+
+	if(!context) {
+		result = EXIT_FAILURE;
+	} else if(!path || !*path) {
+		std::stringstream stream;
+
+		stream << "Invalid include path: " << (path ? path : A65_STRING_EMPTY);
+		context->error = stream.str();
+		result = EXIT_FAILURE;
+	} else {
+		context->include.push_back(path);
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%i(%x)", result, result);
+	return result;
+}
 
 int
 a65_build_archive(
@@ -32,25 +83,56 @@ a65_build_archive(
 	__in const char *name
 	)
 {
-	int result = EXIT_SUCCESS;
+	int result;
 
 	A65_DEBUG_ENTRY_INFO("Input[%i]=%p, Output=%p, Name=%p", count, input, output, name);
 
-	try {
-		a65_assembler assembler;
+	result = a65_build_archive_r(&g_context, count, input, output, name);
 
-		if(!name) {
-			A65_THROW_EXCEPTION_INFO("Invalid name", "%p", name);
-		}
+	A65_DEBUG_EXIT_INFO("Result=%i(%x)", result, result);
+	return result;
+}
 
-		if(!output) {
-			A65_THROW_EXCEPTION_INFO("Invalid output path", "%p", output);
-		}
+int
+a65_build_archive_r(
+	__inout a65_context_t *context,
+	__in int count,
+	__in const char **input,
+	__in const char *output,
+	__in const char *name
+	)
+{
+	int result = EXIT_SUCCESS;
+	a65_intern intern, *previous_intern;
+	a65_uuid uuid, *previous_uuid;
+
+	A65_DEBUG_ENTRY_INFO("Context=%p, Input[%i]=%p, Output=%p, Name=%p", context, count, input, output, name);
 
-		g_output = assembler.build_archive(std::vector<std::string>(input, input + count), output, name);
-	} catch(std::exception &exc) {
-		g_error = exc.what();
+	if(!context) {
 		result = EXIT_FAILURE;
+	} else {
+		previous_uuid = a65_uuid::bind(&uuid);
+		previous_intern = a65_intern::bind(&intern);
+
+		try {
+			a65_assembler assembler;
+
+			if(!name) {
+				A65_THROW_EXCEPTION_INFO("Invalid name", "%p", name);
+			}
+
+			if(!output) {
+				A65_THROW_EXCEPTION_INFO("Invalid output path", "%p", output);
+			}
+
+			context->output = assembler.build_archive(std::vector<std::string>(input, input + count), output, name);
+		} catch(std::exception &exc) {
+			context->error = exc.what();
+			result = EXIT_FAILURE;
+		}
+
+		a65_intern::bind(previous_intern);
+		a65_uuid::bind(previous_uuid);
 	}
 
 	A65_DEBUG_EXIT_INFO("Result=%i(%x)", result, result);
@@ -65,25 +147,68 @@ a65_build_object(
 	__in int source
 	)
 {
-	int result = EXIT_SUCCESS;
+	int result;
 
 	A65_DEBUG_ENTRY_INFO("Input=%p, Output=%p, Header=%x, Source=%x", input, output, header, source);
 
-	try {
-		a65_assembler assembler;
+	result = a65_build_object_r(&g_context, input, output, header, source);
 
-		if(!input) {
-			A65_THROW_EXCEPTION_INFO("Invalid input path", "%p", input);
-		}
+	A65_DEBUG_EXIT_INFO("Result=%i(%x)", result, result);
+	return result;
+}
 
-		if(!output) {
-			A65_THROW_EXCEPTION_INFO("Invalid output path", "%p", output);
-		}
+int
+a65_build_object_r(
+	__inout a65_context_t *context,
+	__in const char *input,
+	__in const char *output,
+	__in int header,
+	__in int source
+	)
+{
+	int result = EXIT_SUCCESS;
+	a65_intern intern, *previous_intern;
+	a65_uuid uuid, *previous_uuid;
 
-		g_output = assembler.build_object(input, output, header, source);
-	} catch(std::exception &exc) {
-		g_error = exc.what();
+	A65_DEBUG_ENTRY_INFO("Context=%p, Input=%p, Output=%p, Header=%x, Source=%x", context, input, output, header, source);
+
+	if(!context) {
 		result = EXIT_FAILURE;
+	} else {
+		previous_uuid = a65_uuid::bind(&uuid);
+		previous_intern = a65_intern::bind(&intern);
+
+		try {
+			a65_assembler assembler;
+
+			if(!input) {
+				A65_THROW_EXCEPTION_INFO("Invalid input path", "%p", input);
+			}
+
+			if(!output) {
+				A65_THROW_EXCEPTION_INFO("Invalid output path", "%p", output);
+			}
+
+			context->statistic[A65_STATISTIC_CACHE_HIT] = 0;
+			context->statistic[A65_STATISTIC_CACHE_MISS] = 0;
+			context->statistic[A65_STATISTIC_RELAXED] = 0;
+			assembler.set_build_cache(context->cache);
+			assembler.set_depend(context->option[A65_OPTION_DEPEND], context->depend);
+			assembler.set_include_path(context->include);
+			assembler.set_relax(context->option[A65_OPTION_RELAX]);
+			context->output = assembler.build_object(input, output, header, source);
+			context->statistic[A65_STATISTIC_RELAXED] = assembler.relaxed();
+
+			if(!context->cache.empty()) {
+				++context->statistic[assembler.build_cached() ? A65_STATISTIC_CACHE_HIT : A65_STATISTIC_CACHE_MISS];
+			}
+		} catch(std::exception &exc) {
+			context->error = exc.what();
+			result = EXIT_FAILURE;
+		}
+
+		a65_intern::bind(previous_intern);
+		a65_uuid::bind(previous_uuid);
 	}
 
 	A65_DEBUG_EXIT_INFO("Result=%i(%x)", result, result);
@@ -100,45 +225,359 @@ a65_compile(
 	__in int ihex
 	)
 {
-	int result = EXIT_SUCCESS;
+	int result;
 
 	A65_DEBUG_ENTRY_INFO("Input[%i]=%p, Output=%p, Name=%p, Binary=%x, Ihex=%x", count, input, output, name, binary, ihex);
 
-	try {
-		a65_assembler assembler;
+	result = a65_compile_r(&g_context, count, input, output, name, binary, ihex);
 
-		if(!name) {
-			A65_THROW_EXCEPTION_INFO("Invalid name path", "%p", name);
-		}
+	A65_DEBUG_EXIT_INFO("Result=%i(%x)", result, result);
+	return result;
+}
 
-		if(!output) {
-			A65_THROW_EXCEPTION_INFO("Invalid output path", "%p", output);
-		}
+int
+a65_compile_r(
+	__inout a65_context_t *context,
+	__in int count,
+	__in const char **input,
+	__in const char *output,
+	__in const char *name,
+	__in int binary,
+	__in int ihex
+	)
+{
+	int result = EXIT_SUCCESS;
+	a65_intern intern, *previous_intern;
+	a65_uuid uuid, *previous_uuid;
 
-		g_output = assembler.compile(std::vector<std::string>(input, input + count), output, name, binary, ihex);
-	} catch(std::exception &exc) {
-		g_error = exc.what();
+	A65_DEBUG_ENTRY_INFO("Context=%p, Input[%i]=%p, Output=%p, Name=%p, Binary=%x, Ihex=%x", context, count, input, output, name,
+		binary, ihex);
+
+	if(!context) {
 		result = EXIT_FAILURE;
+	} else {
+		previous_uuid = a65_uuid::bind(&uuid);
+		previous_intern = a65_intern::bind(&intern);
+
+		try {
+			a65_assembler assembler;
+
+			if(!name) {
+				A65_THROW_EXCEPTION_INFO("Invalid name path", "%p", name);
+			}
+
+			if(!output) {
+				A65_THROW_EXCEPTION_INFO("Invalid output path", "%p", output);
+			}
+
+			context->output = assembler.compile(std::vector<std::string>(input, input + count), output, name, binary, ihex);
+		} catch(std::exception &exc) {
+			context->error = exc.what();
+			result = EXIT_FAILURE;
+		}
+
+		a65_intern::bind(previous_intern);
+		a65_uuid::bind(previous_uuid);
 	}
 
 	A65_DEBUG_EXIT_INFO("Result=%i(%x)", result, result);
 	return result;
 }
 
+a65_context_t *
+a65_context_create(void)
+{
+	a65_context_t *result;
+
+	A65_DEBUG_ENTRY();
+
+	result = new (std::nothrow) a65_context_t();
+
+	A65_DEBUG_EXIT_INFO("Result=%p", result);
+	return result;
+}
+
+void
+a65_context_destroy(
+	__in a65_context_t *context
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Context=%p", context);
+
+	delete context;
+
+	A65_DEBUG_EXIT();
+}
+
 const char *
 a65_error(void)
 {
+	const char *result;
+
 	A65_DEBUG_ENTRY();
-	A65_DEBUG_EXIT_INFO("Result[%u]=%s", g_error.size(), A65_STRING_CHECK(g_error));
-	return g_error.c_str();
+
+	result = a65_error_r(&g_context);
+
+	A65_DEBUG_EXIT_INFO("Result=%s", result);
+	return result;
+}
+
+const char *
+a65_error_r(
+	__in const a65_context_t *context
+	)
+{
+	const char *result = "";
+
+	A65_DEBUG_ENTRY_INFO("Context=%p", context);
+
+	if(context) {
+		result = context->error.c_str();
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%s", result);
+	return result;
 }
 
 const char *
 a65_output_path(void)
 {
+	const char *result;
+
 	A65_DEBUG_ENTRY();
-	A65_DEBUG_EXIT_INFO("Result[%u]=%s", g_output.size(), A65_STRING_CHECK(g_output));
-	return g_output.c_str();
+
+	result = a65_output_path_r(&g_context);
+
+	A65_DEBUG_EXIT_INFO("Result=%s", result);
+	return result;
+}
+
+const char *
+a65_output_path_r(
+	__in const a65_context_t *context
+	)
+{
+	const char *result = "";
+
+	A65_DEBUG_ENTRY_INFO("Context=%p", context);
+
+	if(context) {
+		result = context->output.c_str();
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%s", result);
+	return result;
+}
+
+int
+a65_precompile(
+	__in const char *input,
+	__in const char *output
+	)
+{
+	int result;
+
+	A65_DEBUG_ENTRY_INFO("Input=%p, Output=%p", input, output);
+
+	result = a65_precompile_r(&g_context, input, output);
+
+	A65_DEBUG_EXIT_INFO("Result=%i(%x)", result, result);
+	return result;
+}
+
+int
+a65_precompile_r(
+	__inout a65_context_t *context,
+	__in const char *input,
+	__in const char *output
+	)
+{
+	int result = EXIT_SUCCESS;
+	a65_intern intern, *previous_intern;
+	a65_uuid uuid, *previous_uuid;
+
+	A65_DEBUG_ENTRY_INFO("Context=%p, Input=%p, Output=%p", context, input, output);
+
+	if(!context) {
+		result = EXIT_FAILURE;
+	} else {
+		previous_uuid = a65_uuid::bind(&uuid);
+		previous_intern = a65_intern::bind(&intern);
+
+		try {
+			a65_assembler assembler;
+
+			if(!input) {
+				A65_THROW_EXCEPTION_INFO("Invalid input path", "%p", input);
+			}
+
+			if(!output) {
+				A65_THROW_EXCEPTION_INFO("Invalid output path", "%p", output);
+			}
+
+			assembler.set_include_path(context->include);
+			context->output = assembler.precompile(input, output);
+		} catch(std::exception &exc) {
+			context->error = exc.what();
+			result = EXIT_FAILURE;
+		}
+
+		a65_intern::bind(previous_intern);
+		a65_uuid::bind(previous_uuid);
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%i(%x)", result, result);
+	return result;
+}
+
+int
+a65_set_cache_path(
+	__in const char *path
+	)
+{
+	int result;
+
+	A65_DEBUG_ENTRY_INFO("Path=%p", path);
+
+	result = a65_set_cache_path_r(&g_context, path);
+
+	A65_DEBUG_EXIT_INFO("Result=%i(%x)", result, result);
+	return result;
+}
+
+int
+a65_set_cache_path_r(
+	__inout a65_context_t *context,
+	__in const char *path
+	)
+{
+	int result = EXIT_SUCCESS;
+
+	A65_DEBUG_ENTRY_INFO("Context=%p, Path=%p", context, path);
+
+	if(!context) {
+		result = EXIT_FAILURE;
+	} else if(!path) {
+		context->cache.clear();
+	} else {
+		context->cache = path;
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%i(%x)", result, result);
+	return result;
+}
+
+int
+a65_set_depend_path(
+	__in const char *path
+	)
+{
+	int result;
+
+	A65_DEBUG_ENTRY_INFO("Path=%p", path);
+
+	result = a65_set_depend_path_r(&g_context, path);
+
+	A65_DEBUG_EXIT_INFO("Result=%i(%x)", result, result);
+	return result;
+}
+
+int
+a65_set_depend_path_r(
+	__inout a65_context_t *context,
+	__in const char *path
+	)
+{
+	int result = EXIT_SUCCESS;
+
+	A65_DEBUG_ENTRY_INFO("Context=%p, Path=%p", context, path);
+
+	if(!context) {
+		result = EXIT_FAILURE;
+	} else if(!path) {
+		context->depend.clear();
+	} else {
+		context->depend = path;
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%i(%x)", result, result);
+	return result;
+}
+
+int
+a65_set_option(
+	__in int option,
+	__in int value
+	)
+{
+	int result;
+
+	A65_DEBUG_ENTRY_INFO("Option=%i, Value=%i", option, value);
+
+	result = a65_set_option_r(&g_context, option, value);
+
+	A65_DEBUG_EXIT_INFO("Result=%i(%x)", result, result);
+	return result;
+}
+
+int
+a65_set_option_r(
+	__inout a65_context_t *context,
+	__in int option,
+	__in int value
+	)
+{
+	int result = EXIT_SUCCESS;
+
+	A65_DEBUG_ENTRY_INFO("Context=%p, Option=%i, Value=%i", context, option, value);
+
+	if(!context) {
+		result = EXIT_FAILURE;
+	} else if((option < 0) || (option > A65_OPTION_MAX)) {
+		std::stringstream stream;
+
+		stream << "Invalid option: " << option;
+		context->error = stream.str();
+		result = EXIT_FAILURE;
+	} else {
+		context->option[option] = value;
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%i(%x)", result, result);
+	return result;
+}
+
+unsigned long
+a65_statistic(
+	__in int statistic
+	)
+{
+	unsigned long result;
+
+	A65_DEBUG_ENTRY_INFO("Statistic=%i", statistic);
+
+	result = a65_statistic_r(&g_context, statistic);
+
+	A65_DEBUG_EXIT_INFO("Result=%lu", result);
+	return result;
+}
+
+unsigned long
+a65_statistic_r(
+	__in const a65_context_t *context,
+	__in int statistic
+	)
+{
+	unsigned long result = 0;
+
+	A65_DEBUG_ENTRY_INFO("Context=%p, Statistic=%i", context, statistic);
+
+	if(context && (statistic >= 0) && (statistic <= A65_STATISTIC_MAX)) {
+		result = context->statistic[statistic];
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%lu", result);
+	return result;
 }
 
 void
@@ -16,12 +16,27 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <unistd.h>
+#include <atomic>
 #include <climits>
+#include <thread>
 #include "../inc/a65_assembler.h"
+#include "../inc/a65_include.h"
 #include "../inc/a65_utility.h"
 
+static std::atomic<uint32_t> g_build_file(0);
+
 a65_assembler::a65_assembler(void) :
-		a65_parser(std::string())
+		a65_parser(std::string()),
+		m_build_cached(false),
+		m_dependency_record(false),
+		m_depend(false),
+		m_forward(false),
+		m_include_guard(A65_INTERN_INVALID),
+		m_include_once(false),
+		m_relax(false),
+		m_relaxed(0),
+		m_second_pass(false)
 {
 	A65_DEBUG_ENTRY();
 
@@ -34,16 +49,40 @@ a65_assembler::a65_assembler(
 	__in const a65_assembler &other
 	) :
 		a65_parser(other),
-		m_define(other.m_define),
+		m_build_cache(other.m_build_cache),
+		m_build_cached(other.m_build_cached),
+		m_build_dependency(other.m_build_dependency),
+		m_build_missing(other.m_build_missing),
+		m_dependency_record(false),
+		m_depend(other.m_depend),
+		m_depend_path(other.m_depend_path),
 		m_export(other.m_export),
+		m_expression(other.m_expression),
+		m_expression_code(other.m_expression_code),
+		m_expression_literal(other.m_expression_literal),
+		m_fill(other.m_fill),
+		m_forward(other.m_forward),
+		m_include(other.m_include),
+		m_include_alias(other.m_include_alias),
+		m_include_binary(other.m_include_binary),
+		m_include_define(other.m_include_define),
+		m_include_evaluated(other.m_include_evaluated),
+		m_include_guard(other.m_include_guard),
+		m_include_identity(other.m_include_identity),
+		m_include_loaded(other.m_include_loaded),
+		m_include_once(other.m_include_once),
+		m_include_path(other.m_include_path),
 		m_input(other.m_input),
-		m_label(other.m_label),
+		m_layout(other.m_layout),
 		m_name(other.m_name),
 		m_offset(other.m_offset),
 		m_origin(other.m_origin),
 		m_output(other.m_output),
+		m_relax(other.m_relax),
+		m_relaxed(other.m_relaxed),
 		m_second_pass(other.m_second_pass),
-		m_section(other.m_section)
+		m_section(other.m_section),
+		m_symbol(other.m_symbol)
 {
 	A65_DEBUG_ENTRY();
 	A65_DEBUG_EXIT();
@@ -64,16 +103,39 @@ a65_assembler::operator=(
 
 	if(this != &other) {
 		a65_parser::operator=(other);
-		m_define = other.m_define;
+		m_build_cache = other.m_build_cache;
+		m_build_cached = other.m_build_cached;
+		m_build_dependency = other.m_build_dependency;
+		m_build_missing = other.m_build_missing;
+		m_depend = other.m_depend;
+		m_depend_path = other.m_depend_path;
 		m_export = other.m_export;
+		m_expression = other.m_expression;
+		m_expression_code = other.m_expression_code;
+		m_expression_literal = other.m_expression_literal;
+		m_fill = other.m_fill;
+		m_forward = other.m_forward;
+		m_include = other.m_include;
+		m_include_alias = other.m_include_alias;
+		m_include_binary = other.m_include_binary;
+		m_include_define = other.m_include_define;
+		m_include_evaluated = other.m_include_evaluated;
+		m_include_guard = other.m_include_guard;
+		m_include_identity = other.m_include_identity;
+		m_include_loaded = other.m_include_loaded;
+		m_include_once = other.m_include_once;
+		m_include_path = other.m_include_path;
 		m_input = other.m_input;
-		m_label = other.m_label;
+		m_layout = other.m_layout;
 		m_name = other.m_name;
 		m_offset = other.m_offset;
 		m_origin = other.m_origin;
 		m_output = other.m_output;
+		m_relax = other.m_relax;
+		m_relaxed = other.m_relaxed;
 		m_second_pass = other.m_second_pass;
 		m_section = other.m_section;
+		m_symbol = other.m_symbol;
 	}
 
 	A65_DEBUG_EXIT_INFO("Result=%p", this);
@@ -86,19 +148,16 @@ a65_assembler::add_define(
 	__in uint16_t value
 	)
 {
-	std::string name;
-	std::map<std::string, uint16_t>::iterator entry;
+	uint32_t slot;
 
 	A65_DEBUG_ENTRY_INFO("Token=%p, Value=%u(%04x)", &token, value, value);
 
-	name = token.literal();
-
-	entry = m_define.find(name);
-	if(entry != m_define.end()) {
+	slot = m_symbol.insert(token.symbol());
+	if(m_symbol.entry(slot).flag & A65_SYMBOL_FLAG(A65_SYMBOL_DEFINE)) {
 		A65_THROW_EXCEPTION_INFO("Duplicate define", "%s", A65_STRING_CHECK(token.to_string()));
 	}
 
-	m_define.insert(std::make_pair(name, value));
+	m_symbol.set(A65_SYMBOL_DEFINE, slot, value);
 
 	A65_DEBUG_EXIT();
 }
@@ -125,25 +184,71 @@ a65_assembler::add_export(
 	A65_DEBUG_EXIT();
 }
 
+void
+a65_assembler::add_include(
+	__in const a65_token &token
+	)
+{
+	uint32_t id;
+	std::map<uint32_t, a65_assembler>::iterator entry;
+
+	A65_DEBUG_ENTRY_INFO("Token=%p", &token);
+
+	id = token.id();
+
+	entry = m_include.find(id);
+	if(entry != m_include.end()) {
+		A65_THROW_EXCEPTION_INFO("Duplicate include", "%s", A65_STRING_CHECK(token.to_string()));
+	}
+
+	m_include.insert(std::make_pair(id, a65_assembler()));
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_assembler::add_include_binary(
+	__in const a65_token &token,
+	__in const std::string &path
+	)
+{
+	uint32_t id;
+	std::map<uint32_t, std::shared_ptr<const a65_buffer>>::iterator entry;
+
+	A65_DEBUG_ENTRY_INFO("Token=%p, Path[%u]=%s", &token, path.size(), A65_STRING_CHECK(path));
+
+	id = token.id();
+
+	entry = m_include_binary.find(id);
+	if(entry != m_include_binary.end()) {
+		A65_THROW_EXCEPTION_INFO("Duplicate include", "%s", A65_STRING_CHECK(token.to_string()));
+	}
+
+	try {
+		m_include_binary.insert(std::make_pair(id, std::make_shared<const a65_buffer>(path, true)));
+	} catch(...) {
+		A65_THROW_EXCEPTION_INFO("Include file not found", "%s", A65_STRING_CHECK(token.to_string()));
+	}
+
+	A65_DEBUG_EXIT();
+}
+
 void
 a65_assembler::add_label(
 	__in const a65_token &token,
 	__in uint16_t origin
 	)
 {
-	std::string name;
-	std::map<std::string, uint16_t>::iterator entry;
+	uint32_t slot;
 
 	A65_DEBUG_ENTRY_INFO("Token=%p, Origin=%u(%04x)", &token, origin, origin);
 
-	name = token.literal();
-
-	entry = m_label.find(name);
-	if(entry != m_label.end()) {
+	slot = m_symbol.insert(token.symbol());
+	if(m_symbol.entry(slot).flag & A65_SYMBOL_FLAG(A65_SYMBOL_LABEL)) {
 		A65_THROW_EXCEPTION_INFO("Duplicate label", "%s", A65_STRING_CHECK(token.to_string()));
 	}
 
-	m_label.insert(std::make_pair(name, origin));
+	m_symbol.set(A65_SYMBOL_LABEL, slot, origin);
 
 	A65_DEBUG_EXIT();
 }
@@ -194,6 +299,78 @@ a65_assembler::build_archive(
 	return result;
 }
 
+std::string
+a65_assembler::build_cache_key(
+	__in const std::string &text
+	) const
+{
+	std::stringstream result;
+
+	A65_DEBUG_ENTRY_INFO("Text[%u]=%p", text.size(), &text);
+
+	result << A65_STRING_HEX(uint64_t, a65_utility::hash(text));
+
+	A65_DEBUG_EXIT_INFO("Result[%u]=%s", result.str().size(), A65_STRING_CHECK(result.str()));
+	return result.str();
+}
+
+std::string
+a65_assembler::build_cache_path(
+	__in const std::string &key,
+	__in const std::string &extension
+	) const
+{
+	std::stringstream result;
+
+	A65_DEBUG_ENTRY_INFO("Key[%u]=%s, Extension[%u]=%s", key.size(), A65_STRING_CHECK(key), extension.size(),
+		A65_STRING_CHECK(extension));
+
+	result << m_build_cache;
+
+	if(result.str().back() != A65_ASSEMBLER_OUTPUT_SEPERATOR) {
+		result << A65_ASSEMBLER_OUTPUT_SEPERATOR;
+	}
+
+	result << key << extension;
+
+	A65_DEBUG_EXIT_INFO("Result[%u]=%s", result.str().size(), A65_STRING_CHECK(result.str()));
+	return result.str();
+}
+
+std::string
+a65_assembler::build_cache_text(
+	__in const std::string &name,
+	__in const std::string &data,
+	__in bool header,
+	__in bool source
+	) const
+{
+	std::stringstream result;
+
+	A65_DEBUG_ENTRY_INFO("Name[%u]=%s, Data[%u]=%p, Header=%x, Source=%x", name.size(), A65_STRING_CHECK(name), data.size(), &data,
+		header, source);
+
+	result << A65_VERSION_MAJOR << "." << A65_VERSION_MINOR << "." << A65_VERSION_REVISION
+		<< std::endl << name << std::endl << m_relax << header << source;
+
+	if(header || source) {
+		result << std::endl << m_output;
+	}
+
+	result << std::endl << data;
+
+	A65_DEBUG_EXIT_INFO("Result[%u]=%p", result.str().size(), &result);
+	return result.str();
+}
+
+bool
+a65_assembler::build_cached(void) const
+{
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT_INFO("Result=%x", m_build_cached);
+	return m_build_cached;
+}
+
 std::string
 a65_assembler::build_object(
 	__in const std::string &input,
@@ -202,14 +379,14 @@ a65_assembler::build_object(
 	__in_opt bool source
 	)
 {
-	std::string name, result;
-	std::stringstream processed;
+	bool cache;
+	std::stringstream direct;
+	std::string key, key_text, manifest, manifest_text, name, processed, result;
 
 	A65_DEBUG_ENTRY_INFO("Input[%u]=%p, Output[%u]=%p, Header=%x, Source=%x", input.size(), &input, output.size(), &output, header, source);
 
+	a65_include::clear();
 	m_input = a65_utility::decompose_file_path(input, name);
-	a65_parser::load(input);
-	a65_assembler::clear();
 
 	if(output.empty()) {
 
@@ -222,29 +399,85 @@ a65_assembler::build_object(
 		m_output = output;
 	}
 
-	processed << A65_CHARACTER_COMMENT << " Generated with " << A65 << " Assembler "
-			<< A65_VERSION_MAJOR << "." << A65_VERSION_MINOR << "." << A65_VERSION_REVISION
-		<< std::endl << A65_CHARACTER_COMMENT << " " << A65_NOTICE
-		<< std::endl << A65_CHARACTER_COMMENT << " " << A65_ASSEMBLER_DIVIDER
-		<< std::endl << A65_CHARACTER_COMMENT << " Input: " << input << ", Output: " << m_output
-		<< std::endl << A65_CHARACTER_COMMENT << " " << A65_ASSEMBLER_DIVIDER
-		<< std::endl << preprocess(std::string());
+	cache = (!m_build_cache.empty() && !name.empty());
+	m_build_cached = false;
 
-	if(source) {
-		output_source(name, processed.str());
+	if(cache) {
+		direct << input;
+
+		for(std::vector<std::string>::iterator entry = m_include_path.begin(); entry != m_include_path.end(); ++entry) {
+			direct << std::endl << *entry;
+		}
+
+		manifest_text = build_cache_text(name, direct.str(), header, source);
+		manifest = build_cache_key(manifest_text);
+		key = find_build_manifest(manifest, manifest_text, key_text);
+
+		if(!key.empty()) {
+			result = find_build_cache(key, key_text, name, header, source);
+			m_build_cached = !result.empty();
+		}
 	}
 
-	a65_parser::load(processed.str(), false);
+	if(!m_build_cached) {
+		a65_parser::load(input);
+		a65_assembler::clear();
+		m_build_dependency.clear();
+		m_build_dependency.insert(input);
+		m_build_missing.clear();
 
-	a65_assembler::clear();
-	evaluate(name, processed.str());
+		preprocess_tree();
+		clear_cache();
+		clear_expression();
 
-	m_second_pass = true;
-	a65_assembler::clear();
-	evaluate(name, processed.str());
-	m_second_pass = false;
+		if(source || cache) {
+			processed = preprocess(std::string());
+		}
+
+		if(source) {
+			std::stringstream stream;
+
+			stream << A65_CHARACTER_COMMENT << " Generated with " << A65 << " Assembler "
+					<< A65_VERSION_MAJOR << "." << A65_VERSION_MINOR << "." << A65_VERSION_REVISION
+				<< std::endl << A65_CHARACTER_COMMENT << " " << A65_NOTICE
+				<< std::endl << A65_CHARACTER_COMMENT << " " << A65_ASSEMBLER_DIVIDER
+				<< std::endl << A65_CHARACTER_COMMENT << " Input: " << input << ", Output: " << m_output
+				<< std::endl << A65_CHARACTER_COMMENT << " " << A65_ASSEMBLER_DIVIDER
+				<< std::endl << processed;
+
+			output_source(name, stream.str());
+		}
+
+		if(cache) {
+			key_text = build_cache_text(name, input + processed, header, source);
+			key = build_cache_key(key_text);
+			result = find_build_cache(key, key_text, name, header, source);
+			m_build_cached = !result.empty();
+		}
+
+		if(!m_build_cached) {
+			evaluate_layout();
+
+			m_second_pass = true;
+			a65_assembler::clear();
+			evaluate(*this);
+			m_second_pass = false;
+
+			result = output_object(name, header);
+
+			if(cache) {
+				insert_build_cache(key, key_text, name, header, source);
+			}
+		}
+
+		if(cache) {
+			insert_build_manifest(manifest, manifest_text, key, key_text);
+		}
+	}
 
-	result = output_object(name, header);
+	if(m_depend) {
+		output_depend(result);
+	}
 
 	A65_DEBUG_EXIT_INFO("Result[%u]=%s", result.size(), A65_STRING_CHECK(result));
 	return result;
@@ -256,17 +489,47 @@ a65_assembler::clear(void)
 	A65_DEBUG_ENTRY();
 
 	a65_parser::reset();
-	m_define.clear();
+	m_dependency_record = false;
 	m_export.clear();
+	m_fill.clear();
+	m_include_evaluated.clear();
 
 	if(!m_second_pass) {
-		m_label.clear();
+		m_symbol.clear(A65_SYMBOL_LABEL);
 	}
 
 	m_name.clear();
 	m_offset = 0;
 	m_origin = 0;
+	m_relaxed = 0;
 	m_section.clear();
+	m_symbol.clear(A65_SYMBOL_DEFINE);
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_assembler::clear_cache(void)
+{
+	A65_DEBUG_ENTRY();
+
+	m_cache.clear();
+	m_cache_dependency.clear();
+	m_dependency.clear();
+	m_layout.clear();
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_assembler::clear_expression(void)
+{
+	A65_DEBUG_ENTRY();
+
+	m_expression.clear();
+	m_expression_code.clear();
+	m_expression_literal.clear();
+	m_expression_stack.clear();
 
 	A65_DEBUG_EXIT();
 }
@@ -299,16 +562,192 @@ a65_assembler::compile(
 	return result;
 }
 
+void
+a65_assembler::compile_expression(
+	__in a65_parser &parser,
+	__in a65_tree &tree
+	)
+{
+	a65_assembler_instruction_t instruction = { A65_ASSEMBLER_OPCODE_CONSTANT, A65_TOKEN_SUBTYPE_UNDEFINED, 0, 0,
+		A65_SYMBOL_INVALID, A65_INTERN_INVALID, tree.node().token() };
+
+	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
+
+	const a65_token &entry = parser.token_ref(tree.node().token());
+
+	switch(tree.node().type()) {
+		case A65_NODE_EXPRESSION:
+			a65_tree::move_child(tree, 0);
+			compile_expression(parser, tree);
+			a65_tree::move_parent(tree);
+			break;
+		case A65_NODE_CONSTANT:
+
+			switch(entry.type()) {
+				case A65_TOKEN_CONSTANT:
+
+					switch(entry.subtype()) {
+						case A65_TOKEN_CONSTANT_FALSE:
+							instruction.value = false;
+							break;
+						case A65_TOKEN_CONSTANT_NULL:
+							instruction.value = (uint16_t)NULL;
+							break;
+						case A65_TOKEN_CONSTANT_TRUE:
+							instruction.value = true;
+							break;
+						default:
+							A65_THROW_EXCEPTION_INFO("Malformed expression tree", "%s",
+											A65_STRING_CHECK(entry.to_string()));
+					}
+					break;
+				case A65_TOKEN_IDENTIFIER:
+					find_symbol(tree, entry);
+					instruction.opcode = A65_ASSEMBLER_OPCODE_SYMBOL;
+					instruction.slot = tree.node().slot();
+					instruction.symbol = entry.symbol();
+					break;
+				case A65_TOKEN_LITERAL:
+
+					if(tree.node().has_child(0)) {
+						a65_tree::move_child(tree, 0);
+						compile_expression(parser, tree);
+						a65_tree::move_parent(tree);
+						instruction.opcode = A65_ASSEMBLER_OPCODE_LITERAL;
+						instruction.value = entry.literal().size();
+						instruction.literal = m_expression_literal.size();
+
+						if(!compile_expression_fold(instruction, entry)) {
+							m_expression_literal += entry.literal();
+						}
+					} else if(!entry.literal().empty()) {
+						instruction.value = entry.literal().front();
+					}
+					break;
+				case A65_TOKEN_SCALAR:
+					instruction.value = entry.scalar();
+					break;
+				default:
+					A65_THROW_EXCEPTION_INFO("Malformed expression tree", "%s", A65_STRING_CHECK(entry.to_string()));
+			}
+
+			m_expression_code.push_back(instruction);
+			break;
+		case A65_NODE_MACRO:
+			a65_tree::move_child(tree, 0);
+			compile_expression(parser, tree);
+			a65_tree::move_parent(tree);
+			instruction.opcode = A65_ASSEMBLER_OPCODE_MACRO;
+			instruction.subtype = entry.subtype();
+			compile_expression_fold(instruction, entry);
+			m_expression_code.push_back(instruction);
+			break;
+		case A65_NODE_OPERATOR:
+			a65_tree::move_child(tree, 0);
+			compile_expression(parser, tree);
+			a65_tree::move_parent(tree);
+
+			a65_tree::move_child(tree, 1);
+			compile_expression(parser, tree);
+			a65_tree::move_parent(tree);
+
+			instruction.opcode = A65_ASSEMBLER_OPCODE_OPERATOR;
+			instruction.subtype = entry.subtype();
+			compile_expression_fold(instruction, entry);
+			m_expression_code.push_back(instruction);
+			break;
+		case A65_NODE_UNARY:
+			a65_tree::move_child(tree, 0);
+			compile_expression(parser, tree);
+			a65_tree::move_parent(tree);
+			instruction.opcode = A65_ASSEMBLER_OPCODE_UNARY;
+			instruction.subtype = entry.subtype();
+			compile_expression_fold(instruction, entry);
+			m_expression_code.push_back(instruction);
+			break;
+		default:
+			A65_THROW_EXCEPTION_INFO("Malformed expression tree", "%s", A65_STRING_CHECK(entry.to_string()));
+	}
+
+	A65_DEBUG_EXIT();
+}
+
+bool
+a65_assembler::compile_expression_fold(
+	__inout a65_assembler_instruction_t &instruction,
+	__in const a65_token &entry
+	)
+{
+	bool result = false;
+	uint16_t left = 0, right = 0, value = 0;
+	size_t count = ((instruction.opcode == A65_ASSEMBLER_OPCODE_OPERATOR) ? 2 : 1);
+
+	A65_DEBUG_ENTRY_INFO("Instruction=%p, Entry=%s", &instruction, A65_STRING_CHECK(entry.to_string()));
+
+	if(m_expression_code.size() >= count) {
+		result = true;
+
+		for(std::vector<a65_assembler_instruction_t>::iterator operand = (m_expression_code.end() - count);
+				operand != m_expression_code.end(); ++operand) {
+
+			if(operand->opcode != A65_ASSEMBLER_OPCODE_CONSTANT) {
+				result = false;
+				break;
+			}
+		}
+	}
+
+	if(result) {
+		right = m_expression_code.back().value;
+		left = m_expression_code.at(m_expression_code.size() - count).value;
+
+		switch(instruction.opcode) {
+			case A65_ASSEMBLER_OPCODE_LITERAL:
+				result = (right < instruction.value);
+				if(result) {
+					value = entry.literal().at(right);
+				}
+				break;
+			case A65_ASSEMBLER_OPCODE_MACRO:
+				value = evaluate_macro(instruction.subtype, right);
+				break;
+			case A65_ASSEMBLER_OPCODE_OPERATOR:
+				result = (right || !A65_IS_TOKEN_SYMBOL_DIVISION(instruction.subtype));
+				if(result) {
+					value = evaluate_operator(instruction.subtype, left, right);
+				}
+				break;
+			case A65_ASSEMBLER_OPCODE_UNARY:
+				value = evaluate_unary(instruction.subtype, right);
+				break;
+			default:
+				result = false;
+				break;
+		}
+	}
+
+	if(result) {
+		m_expression_code.resize(m_expression_code.size() - count);
+		instruction.opcode = A65_ASSEMBLER_OPCODE_CONSTANT;
+		instruction.subtype = A65_TOKEN_SUBTYPE_UNDEFINED;
+		instruction.value = value;
+		instruction.literal = 0;
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%x, Value=%u(%04x)", result, value, value);
+	return result;
+}
+
 bool
 a65_assembler::contains_define(
-	__in const std::string &name
+	__in uint32_t id
 	) const
 {
 	bool result;
 
-	A65_DEBUG_ENTRY_INFO("Name[%u]=%s", name.size(), A65_STRING_CHECK(name));
+	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
 
-	result = (m_define.find(name) != m_define.end());
+	result = m_symbol.contains(A65_SYMBOL_DEFINE, id);
 
 	A65_DEBUG_EXIT_INFO("Result=%x", result);
 	return result;
@@ -329,16 +768,37 @@ a65_assembler::contains_export(
 	return result;
 }
 
+bool
+a65_assembler::contains_include(
+	__in uint32_t id
+	) const
+{
+	bool result;
+	std::map<uint32_t, uint32_t>::const_iterator alias;
+
+	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
+
+	alias = m_include_alias.find(id);
+	if(alias != m_include_alias.end()) {
+		id = alias->second;
+	}
+
+	result = (m_include.find(id) != m_include.end());
+
+	A65_DEBUG_EXIT_INFO("Result=%x", result);
+	return result;
+}
+
 bool
 a65_assembler::contains_label(
-	__in const std::string &name
+	__in uint32_t id
 	) const
 {
 	bool result;
 
-	A65_DEBUG_ENTRY_INFO("Name[%u]=%s", name.size(), A65_STRING_CHECK(name));
+	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
 
-	result = (m_label.find(name) != m_label.end());
+	result = m_symbol.contains(A65_SYMBOL_LABEL, id);
 
 	A65_DEBUG_EXIT_INFO("Result=%x", result);
 	return result;
@@ -361,67 +821,91 @@ a65_assembler::contains_section(
 
 void
 a65_assembler::evaluate(
-	__in const std::string &name,
-	__in const std::string &input
+	__in a65_parser &parser
 	)
 {
-	A65_DEBUG_ENTRY_INFO("Name[%u]=%s, Input[%u]=%p", name.size(), A65_STRING_CHECK(name), input.size(), &input);
+	size_t position = 0;
+	std::vector<uint8_t> data;
+	std::vector<a65_assembler_cache_t> *cache = nullptr;
 
-	a65_parser::load(input, false);
-	a65_lexer::set_metadata(name);
+	A65_DEBUG_ENTRY_INFO("Parser=%p", &parser);
 
-	while(a65_parser::has_next()) {
-		a65_tree tree = a65_parser::tree();
+	parser.reset();
+	cache = &m_cache[&parser];
+
+	while(parser.has_next()) {
+		a65_tree &tree = parser.tree_ref();
 
 		if(!tree.node().match(A65_NODE_BEGIN)
 				&& !tree.node().match(A65_NODE_END)) {
-			std::vector<uint8_t> data;
-
-			data = evaluate(*this, tree);
-			if(!data.empty()) {
 
-				if(!contains_section(m_origin)) {
+			if(tree.node().match(A65_NODE_PRAGMA)
+					&& contains_include(tree.node().token())) {
+				a65_assembler &include = find_include(tree.node().token())->second;
 
-					if(m_name.empty()) {
-						std::stringstream stream;
+				if(evaluate_include_guard(include)) {
+					evaluate(include);
+				}
+			} else {
+				size_t size;
+
+				if(position >= cache->size()) {
+					cache->resize(position + 1);
+				}
+
+				data.clear();
+				m_fill.clear();
+				size = evaluate_cache(parser, tree, cache->at(position), data);
+
+				if(!m_second_pass) {
+					m_offset += size;
+				} else if(!data.empty() || !m_fill.empty()) {
+					a65_section *section = nullptr;
+
+					if(!contains_section(m_origin)) {
 
-						stream << A65_ASSEMBLER_SECTION_NAME_DEFAULT << "_" << A65_STRING_HEX(uint16_t, m_origin);
-						m_name = stream.str();
+						if(m_name.empty()) {
+							std::stringstream stream;
+
+							stream << A65_ASSEMBLER_SECTION_NAME_DEFAULT << "_" << A65_STRING_HEX(uint16_t, m_origin);
+							m_name = stream.str();
+						}
+
+						add_section(m_name, m_origin);
+						m_name.clear();
 					}
 
-					add_section(m_name, m_origin);
-					m_name.clear();
+					section = &find_section(m_origin)->second;
+					section->add(data, tree.id(), m_fill);
+					m_offset += section->length(section->count() - 1);
 				}
-
-				find_section(m_origin)->second.add(data, tree.id());
-				m_offset += data.size();
 			}
 		}
 
-		a65_parser::move_next();
+		++position;
+		parser.move_next();
 	}
 
 	A65_DEBUG_EXIT();
 }
 
-std::vector<uint8_t>
+void
 a65_assembler::evaluate(
 	__in a65_parser &parser,
-	__in a65_tree &tree
+	__in a65_tree &tree,
+	__inout std::vector<uint8_t> &result
 	)
 {
-	a65_token entry;
-	std::vector<uint8_t> result;
 
 	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
 
-	entry = parser.token(tree.node().token());
+	const a65_token &entry = parser.token_ref(tree.node().token());
 	switch(entry.type()) {
 		case A65_TOKEN_COMMAND:
-			result = evaluate_command(parser, tree);
+			evaluate_command(parser, tree, result);
 			break;
 		case A65_TOKEN_DIRECTIVE:
-			result = evaluate_directive(parser, tree);
+			evaluate_directive(parser, tree, result);
 			break;
 		case A65_TOKEN_LABEL:
 
@@ -431,30 +915,124 @@ a65_assembler::evaluate(
 			}
 			break;
 		case A65_TOKEN_PRAGMA:
-			result = evaluate_pragma(parser, tree);
+			evaluate_pragma(parser, tree, result);
 			break;
 		default:
 			A65_THROW_EXCEPTION_INFO("Malformed tree", "%s", A65_STRING_CHECK(entry.to_string()));
 	}
 
 	A65_DEBUG_EXIT();
+}
+
+int
+a65_assembler::evaluate_branch(
+	__in int type,
+	__in uint16_t operand
+	) const
+{
+	int result;
+
+	A65_DEBUG_ENTRY_INFO("Type=%u(%s), Operand=%u(%04x)", type, A65_TOKEN_COMMAND_STRING(type), operand, operand);
+
+	result = ((int) operand - (int) (m_origin + m_offset) - A65_TOKEN_COMMAND_LENGTH(type, A65_TOKEN_COMMAND_MODE_RELATIVE));
+
+	A65_DEBUG_EXIT_INFO("Result=%i", result);
+	return result;
+}
+
+int
+a65_assembler::evaluate_branch_inverse(
+	__in int type
+	) const
+{
+	int result = 0;
+
+	A65_DEBUG_ENTRY_INFO("Type=%u(%s)", type, A65_TOKEN_COMMAND_STRING(type));
+
+	switch(type) {
+		case A65_TOKEN_COMMAND_BCC:
+			result = A65_TOKEN_COMMAND_BCS;
+			break;
+		case A65_TOKEN_COMMAND_BCS:
+			result = A65_TOKEN_COMMAND_BCC;
+			break;
+		case A65_TOKEN_COMMAND_BEQ:
+			result = A65_TOKEN_COMMAND_BNE;
+			break;
+		case A65_TOKEN_COMMAND_BMI:
+			result = A65_TOKEN_COMMAND_BPL;
+			break;
+		case A65_TOKEN_COMMAND_BNE:
+			result = A65_TOKEN_COMMAND_BEQ;
+			break;
+		case A65_TOKEN_COMMAND_BPL:
+			result = A65_TOKEN_COMMAND_BMI;
+			break;
+		case A65_TOKEN_COMMAND_BVC:
+			result = A65_TOKEN_COMMAND_BVS;
+			break;
+		case A65_TOKEN_COMMAND_BVS:
+			result = A65_TOKEN_COMMAND_BVC;
+			break;
+		default:
+			A65_THROW_EXCEPTION_INFO("Unsupported branch", "%u(%s)", type, A65_TOKEN_COMMAND_STRING(type));
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u(%s)", result, A65_TOKEN_COMMAND_STRING(result));
 	return result;
 }
 
-std::vector<uint8_t>
+size_t
+a65_assembler::evaluate_cache(
+	__in a65_parser &parser,
+	__in a65_tree &tree,
+	__inout a65_assembler_cache_t &cache,
+	__inout std::vector<uint8_t> &result
+	)
+{
+	size_t length = 0;
+
+	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p, Cache=%p", &parser, &tree, &cache);
+
+	if(m_second_pass) {
+		evaluate(parser, tree, result);
+	} else {
+		const a65_token &entry = parser.token_ref(tree.node().token());
+		if((entry.match(A65_TOKEN_COMMAND) && (entry.mode() != A65_TOKEN_COMMAND_MODE_RELATIVE))
+				|| entry.match(A65_TOKEN_DIRECTIVE, A65_TOKEN_DIRECTIVE_DATA_BYTE)
+				|| entry.match(A65_TOKEN_DIRECTIVE, A65_TOKEN_DIRECTIVE_DATA_WORD)) {
+
+			if(cache.valid && evaluate_dependency(cache)) {
+				length = cache.length;
+			} else {
+				m_dependency.clear();
+				m_dependency_record = true;
+				length = evaluate_size(parser, tree);
+				m_dependency_record = false;
+				insert_cache(cache, length);
+			}
+		} else {
+			length = evaluate_size(parser, tree);
+		}
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u", length);
+	return length;
+}
+
+void
 a65_assembler::evaluate_command(
 	__in a65_parser &parser,
-	__in a65_tree &tree
+	__in a65_tree &tree,
+	__inout std::vector<uint8_t> &result
 	)
 {
-	int mode, type;
-	a65_token entry;
 	uint16_t operand;
-	std::vector<uint8_t> result;
+	int displacement, mode, type;
 
 	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
 
-	entry = parser.token(tree.node().token());
+	const a65_token &entry = parser.token_ref(tree.node().token());
 	if(!entry.match(A65_TOKEN_COMMAND)) {
 		A65_THROW_EXCEPTION_INFO("Malformed command tree", "%s", A65_STRING_CHECK(entry.to_string()));
 	}
@@ -468,18 +1046,19 @@ a65_assembler::evaluate_command(
 		switch(mode) {
 			case A65_TOKEN_COMMAND_MODE_ABSOLUTE:
 
-				if(!A65_IS_COMMAND_ABSOLUTE(type)) {
+				if(!A65_IS_TOKEN_COMMAND_ABSOLUTE(type)) {
 					A65_THROW_EXCEPTION_INFO("Unsupported addressing mode", "%s", A65_STRING_CHECK(entry.to_string()));
 				}
 
-				opcode = A65_COMMAND_ABSOLUTE_OPCODE(type);
+				opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ABSOLUTE);
 
 				a65_tree::move_child(tree, 0);
 				operand = evaluate_expression(parser, tree);
 				a65_tree::move_parent(tree);
 
-				if((operand <= UINT8_MAX) && A65_IS_COMMAND_ZEROPAGE(entry.subtype())) {
-					opcode = A65_COMMAND_ZEROPAGE_OPCODE(type);
+				if((operand <= UINT8_MAX) && A65_IS_TOKEN_COMMAND_ZEROPAGE(type)
+						&& evaluate_size_short(tree, A65_TOKEN_COMMAND_MODE_ZEROPAGE)) {
+					opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ZEROPAGE);
 					result.push_back(opcode);
 					result.push_back(operand);
 				} else {
@@ -490,18 +1069,19 @@ a65_assembler::evaluate_command(
 				break;
 			case A65_TOKEN_COMMAND_MODE_ABSOLUTE_INDEX_INDIRECT:
 
-				if(!A65_IS_COMMAND_ABSOLUTE_INDEX_INDIRECT(type)) {
+				if(!A65_IS_TOKEN_COMMAND_ABSOLUTE_INDEX_INDIRECT(type)) {
 					A65_THROW_EXCEPTION_INFO("Unsupported addressing mode", "%s", A65_STRING_CHECK(entry.to_string()));
 				}
 
-				opcode = A65_COMMAND_ABSOLUTE_INDEX_INDIRECT_OPCODE(type);
+				opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ABSOLUTE_INDEX_INDIRECT);
 
 				a65_tree::move_child(tree, 0);
 				operand = evaluate_expression(parser, tree);
 				a65_tree::move_parent(tree);
 
-				if((operand <= UINT8_MAX) && A65_IS_COMMAND_ZEROPAGE_INDEX_INDIRECT(entry.subtype())) {
-					opcode = A65_COMMAND_ZEROPAGE_INDEX_INDIRECT_OPCODE(type);
+				if((operand <= UINT8_MAX) && A65_IS_TOKEN_COMMAND_ZEROPAGE_INDEX_INDIRECT(type)
+						&& evaluate_size_short(tree, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDEX_INDIRECT)) {
+					opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDEX_INDIRECT);
 					result.push_back(opcode);
 					result.push_back(operand);
 				} else {
@@ -512,18 +1092,19 @@ a65_assembler::evaluate_command(
 				break;
 			case A65_TOKEN_COMMAND_MODE_ABSOLUTE_INDEX_X:
 
-				if(!A65_IS_COMMAND_ABSOLUTE_INDEX_X(type)) {
+				if(!A65_IS_TOKEN_COMMAND_ABSOLUTE_INDEX_X(type)) {
 					A65_THROW_EXCEPTION_INFO("Unsupported addressing mode", "%s", A65_STRING_CHECK(entry.to_string()));
 				}
 
-				opcode = A65_COMMAND_ABSOLUTE_INDEX_X_OPCODE(type);
+				opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ABSOLUTE_INDEX_X);
 
 				a65_tree::move_child(tree, 0);
 				operand = evaluate_expression(parser, tree);
 				a65_tree::move_parent(tree);
 
-				if((operand <= UINT8_MAX) && A65_IS_COMMAND_ZEROPAGE_INDEX_X(entry.subtype())) {
-					opcode = A65_COMMAND_ZEROPAGE_INDEX_X_OPCODE(type);
+				if((operand <= UINT8_MAX) && A65_IS_TOKEN_COMMAND_ZEROPAGE_INDEX_X(type)
+						&& evaluate_size_short(tree, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDEX_X)) {
+					opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDEX_X);
 					result.push_back(opcode);
 					result.push_back(operand);
 				} else {
@@ -534,18 +1115,19 @@ a65_assembler::evaluate_command(
 				break;
 			case A65_TOKEN_COMMAND_MODE_ABSOLUTE_INDEX_Y:
 
-				if(!A65_IS_COMMAND_ABSOLUTE_INDEX_Y(type)) {
+				if(!A65_IS_TOKEN_COMMAND_ABSOLUTE_INDEX_Y(type)) {
 					A65_THROW_EXCEPTION_INFO("Unsupported addressing mode", "%s", A65_STRING_CHECK(entry.to_string()));
 				}
 
-				opcode = A65_COMMAND_ABSOLUTE_INDEX_Y_OPCODE(type);
+				opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ABSOLUTE_INDEX_Y);
 
 				a65_tree::move_child(tree, 0);
 				operand = evaluate_expression(parser, tree);
 				a65_tree::move_parent(tree);
 
-				if((operand <= UINT8_MAX) && A65_IS_COMMAND_ZEROPAGE_INDEX_Y(entry.subtype())) {
-					opcode = A65_COMMAND_ZEROPAGE_INDEX_Y_OPCODE(type);
+				if((operand <= UINT8_MAX) && A65_IS_TOKEN_COMMAND_ZEROPAGE_INDEX_Y(type)
+						&& evaluate_size_short(tree, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDEX_Y)) {
+					opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDEX_Y);
 					result.push_back(opcode);
 					result.push_back(operand);
 				} else {
@@ -556,18 +1138,19 @@ a65_assembler::evaluate_command(
 				break;
 			case A65_TOKEN_COMMAND_MODE_ABSOLUTE_INDIRECT:
 
-				if(!A65_IS_COMMAND_ABSOLUTE_INDIRECT(type)) {
+				if(!A65_IS_TOKEN_COMMAND_ABSOLUTE_INDIRECT(type)) {
 					A65_THROW_EXCEPTION_INFO("Unsupported addressing mode", "%s", A65_STRING_CHECK(entry.to_string()));
 				}
 
-				opcode = A65_COMMAND_ABSOLUTE_INDIRECT_OPCODE(type);
+				opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ABSOLUTE_INDIRECT);
 
 				a65_tree::move_child(tree, 0);
 				operand = evaluate_expression(parser, tree);
 				a65_tree::move_parent(tree);
 
-				if((operand <= UINT8_MAX) && A65_IS_COMMAND_ZEROPAGE_INDIRECT(entry.subtype())) {
-					opcode = A65_COMMAND_ZEROPAGE_INDIRECT_OPCODE(type);
+				if((operand <= UINT8_MAX) && A65_IS_TOKEN_COMMAND_ZEROPAGE_INDIRECT(type)
+						&& evaluate_size_short(tree, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDIRECT)) {
+					opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDIRECT);
 					result.push_back(opcode);
 					result.push_back(operand);
 				} else {
@@ -578,20 +1161,20 @@ a65_assembler::evaluate_command(
 				break;
 			case A65_TOKEN_COMMAND_MODE_ACCUMULATOR:
 
-				if(!A65_IS_COMMAND_ACCUMULATOR(type)) {
+				if(!A65_IS_TOKEN_COMMAND_ACCUMULATOR(type)) {
 					A65_THROW_EXCEPTION_INFO("Unsupported addressing mode", "%s", A65_STRING_CHECK(entry.to_string()));
 				}
 
-				opcode = A65_COMMAND_ACCUMULATOR_OPCODE(type);
+				opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ACCUMULATOR);
 				result.push_back(opcode);
 				break;
 			case A65_TOKEN_COMMAND_MODE_IMMEDIATE:
 
-				if(!A65_IS_COMMAND_IMMEDIATE(type)) {
+				if(!A65_IS_TOKEN_COMMAND_IMMEDIATE(type)) {
 					A65_THROW_EXCEPTION_INFO("Unsupported addressing mode", "%s", A65_STRING_CHECK(entry.to_string()));
 				}
 
-				opcode = A65_COMMAND_IMMEDIATE_OPCODE(type);
+				opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_IMMEDIATE);
 
 				a65_tree::move_child(tree, 0);
 				operand = evaluate_expression(parser, tree);
@@ -602,40 +1185,55 @@ a65_assembler::evaluate_command(
 				break;
 			case A65_TOKEN_COMMAND_MODE_IMPLIED:
 
-				if(!A65_IS_COMMAND_IMPLIED(type)) {
+				if(!A65_IS_TOKEN_COMMAND_IMPLIED(type)) {
 					A65_THROW_EXCEPTION_INFO("Unsupported addressing mode", "%s", A65_STRING_CHECK(entry.to_string()));
 				}
 
-				opcode = A65_COMMAND_IMPLIED_OPCODE(type);
+				opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_IMPLIED);
 				result.push_back(opcode);
 				break;
 			case A65_TOKEN_COMMAND_MODE_RELATIVE:
 
-				if(!A65_IS_COMMAND_RELATIVE(type)) {
+				if(!A65_IS_TOKEN_COMMAND_RELATIVE(type)) {
 					A65_THROW_EXCEPTION_INFO("Unsupported addressing mode", "%s", A65_STRING_CHECK(entry.to_string()));
 				}
 
-				opcode = A65_COMMAND_RELATIVE_OPCODE(type);
+				opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_RELATIVE);
 
 				a65_tree::move_child(tree, 0);
 				operand = evaluate_expression(parser, tree);
 				a65_tree::move_parent(tree);
 
-				if(m_second_pass && ((operand < ((m_origin + m_offset) - UINT8_MAX))
-						|| (operand > ((m_origin + m_offset) + UINT8_MAX)))) {
-					A65_THROW_EXCEPTION_INFO("Relative jump out-of-range", "%s", A65_STRING_CHECK(entry.to_string()));
-				}
+				displacement = evaluate_branch(type, operand);
+				if(m_relax && A65_IS_ASSEMBLER_BRANCH_RELAXABLE(type) && (!A65_IS_ASSEMBLER_BRANCH_DISPLACEMENT(displacement)
+						|| !evaluate_size_short(tree, A65_TOKEN_COMMAND_MODE_RELATIVE))) {
 
-				result.push_back(opcode);
-				result.push_back(operand - (m_origin + m_offset) - A65_COMMAND_RELATIVE_LENGTH(type));
+					if(type != A65_TOKEN_COMMAND_BRA) {
+						result.push_back(A65_TOKEN_COMMAND_OPCODE(evaluate_branch_inverse(type), A65_TOKEN_COMMAND_MODE_RELATIVE));
+						result.push_back(A65_TOKEN_COMMAND_LENGTH(A65_TOKEN_COMMAND_JMP, A65_TOKEN_COMMAND_MODE_ABSOLUTE));
+					}
+
+					result.push_back(A65_TOKEN_COMMAND_OPCODE(A65_TOKEN_COMMAND_JMP, A65_TOKEN_COMMAND_MODE_ABSOLUTE));
+					result.push_back(operand);
+					result.push_back(operand >> CHAR_BIT);
+					++m_relaxed;
+				} else {
+
+					if(m_second_pass && !A65_IS_ASSEMBLER_BRANCH_DISPLACEMENT(displacement)) {
+						A65_THROW_EXCEPTION_INFO("Relative jump out-of-range", "%s", A65_STRING_CHECK(entry.to_string()));
+					}
+
+					result.push_back(opcode);
+					result.push_back(displacement);
+				}
 				break;
 			case A65_TOKEN_COMMAND_MODE_ZEROPAGE:
 
-				if(!A65_IS_COMMAND_ZEROPAGE(type)) {
+				if(!A65_IS_TOKEN_COMMAND_ZEROPAGE(type)) {
 					A65_THROW_EXCEPTION_INFO("Unsupported addressing mode", "%s", A65_STRING_CHECK(entry.to_string()));
 				}
 
-				opcode = A65_COMMAND_ZEROPAGE_OPCODE(type);
+				opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ZEROPAGE);
 
 				a65_tree::move_child(tree, 0);
 				operand = evaluate_expression(parser, tree);
@@ -646,11 +1244,11 @@ a65_assembler::evaluate_command(
 				break;
 			case A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDEX_INDIRECT:
 
-				if(!A65_IS_COMMAND_ZEROPAGE_INDEX_INDIRECT(type)) {
+				if(!A65_IS_TOKEN_COMMAND_ZEROPAGE_INDEX_INDIRECT(type)) {
 					A65_THROW_EXCEPTION_INFO("Unsupported addressing mode", "%s", A65_STRING_CHECK(entry.to_string()));
 				}
 
-				opcode = A65_COMMAND_ZEROPAGE_INDEX_INDIRECT_OPCODE(type);
+				opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDEX_INDIRECT);
 
 				a65_tree::move_child(tree, 0);
 				operand = evaluate_expression(parser, tree);
@@ -661,11 +1259,11 @@ a65_assembler::evaluate_command(
 				break;
 			case A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDEX_X:
 
-				if(!A65_IS_COMMAND_ZEROPAGE_INDEX_X(type)) {
+				if(!A65_IS_TOKEN_COMMAND_ZEROPAGE_INDEX_X(type)) {
 					A65_THROW_EXCEPTION_INFO("Unsupported addressing mode", "%s", A65_STRING_CHECK(entry.to_string()));
 				}
 
-				opcode = A65_COMMAND_ZEROPAGE_INDEX_X_OPCODE(type);
+				opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDEX_X);
 
 				a65_tree::move_child(tree, 0);
 				operand = evaluate_expression(parser, tree);
@@ -676,11 +1274,11 @@ a65_assembler::evaluate_command(
 				break;
 			case A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDEX_Y:
 
-				if(!A65_IS_COMMAND_ZEROPAGE_INDEX_Y(type)) {
+				if(!A65_IS_TOKEN_COMMAND_ZEROPAGE_INDEX_Y(type)) {
 					A65_THROW_EXCEPTION_INFO("Unsupported addressing mode", "%s", A65_STRING_CHECK(entry.to_string()));
 				}
 
-				opcode = A65_COMMAND_ZEROPAGE_INDEX_Y_OPCODE(type);
+				opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDEX_Y);
 
 				a65_tree::move_child(tree, 0);
 				operand = evaluate_expression(parser, tree);
@@ -691,11 +1289,11 @@ a65_assembler::evaluate_command(
 				break;
 			case A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDIRECT:
 
-				if(!A65_IS_COMMAND_ZEROPAGE_INDIRECT(type)) {
+				if(!A65_IS_TOKEN_COMMAND_ZEROPAGE_INDIRECT(type)) {
 					A65_THROW_EXCEPTION_INFO("Unsupported addressing mode", "%s", A65_STRING_CHECK(entry.to_string()));
 				}
 
-				opcode = A65_COMMAND_ZEROPAGE_INDIRECT_OPCODE(type);
+				opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDIRECT);
 
 				a65_tree::move_child(tree, 0);
 				operand = evaluate_expression(parser, tree);
@@ -706,11 +1304,11 @@ a65_assembler::evaluate_command(
 				break;
 			case A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDIRECT_INDEX:
 
-				if(!A65_IS_COMMAND_ZEROPAGE_INDIRECT_INDEX(type)) {
+				if(!A65_IS_TOKEN_COMMAND_ZEROPAGE_INDIRECT_INDEX(type)) {
 					A65_THROW_EXCEPTION_INFO("Unsupported addressing mode", "%s", A65_STRING_CHECK(entry.to_string()));
 				}
 
-				opcode = A65_COMMAND_ZEROPAGE_INDIRECT_INDEX_OPCODE(type);
+				opcode = A65_TOKEN_COMMAND_OPCODE(type, A65_TOKEN_COMMAND_MODE_ZEROPAGE_INDIRECT_INDEX);
 
 				a65_tree::move_child(tree, 0);
 				operand = evaluate_expression(parser, tree);
@@ -730,7 +1328,7 @@ a65_assembler::evaluate_command(
 			operand = evaluate_expression(parser, tree);
 			a65_tree::move_parent(tree);
 
-			if(operand <= UINT8_MAX) {
+			if((operand <= UINT8_MAX) && evaluate_size_short(tree, A65_TOKEN_COMMAND_MODE_ZEROPAGE)) {
 				result.push_back(operand);
 			} else {
 				result.push_back(operand);
@@ -740,7 +1338,6 @@ a65_assembler::evaluate_command(
 	}
 
 	A65_DEBUG_EXIT();
-	return result;
 }
 
 bool
@@ -749,7 +1346,6 @@ a65_assembler::evaluate_condition(
 	__in a65_tree &tree
 	)
 {
-	a65_token entry;
 	bool result = false;
 
 	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
@@ -765,7 +1361,7 @@ a65_assembler::evaluate_condition(
 		right = evaluate_expression(parser, tree);
 		a65_tree::move_parent(tree);
 
-		entry = parser.token(tree.node().token());
+		const a65_token &entry = parser.token_ref(tree.node().token());
 		switch(entry.subtype()) {
 			case A65_TOKEN_SYMBOL_OPERATOR_EQUALS:
 				result = (left == right);
@@ -798,30 +1394,50 @@ a65_assembler::evaluate_condition(
 	return result;
 }
 
-std::vector<uint8_t>
+bool
+a65_assembler::evaluate_dependency(
+	__in const a65_assembler_cache_t &cache
+	)
+{
+	bool result = true;
+
+	A65_DEBUG_ENTRY_INFO("Cache=%p", &cache);
+
+	for(uint32_t index = cache.dependency; result && (index < (cache.dependency + cache.dependency_count)); ++index) {
+		uint16_t value = 0;
+		const a65_assembler_dependency_t &dependency = m_cache_dependency[index];
+
+		result = (evaluate_symbol(m_symbol.entry(dependency.slot), value) && (value == dependency.value));
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%x", result);
+	return result;
+}
+
+void
 a65_assembler::evaluate_directive(
 	__in a65_parser &parser,
-	__in a65_tree &tree
+	__in a65_tree &tree,
+	__inout std::vector<uint8_t> &result
 	)
 {
 	int type;
-	a65_token entry;
+	const a65_token *entry = nullptr;
 	uint16_t value = 1;
 	bool branch = false;
-	std::vector<uint8_t> result;
 
 	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
 
-	entry = parser.token(tree.node().token());
+	entry = &parser.token_ref(tree.node().token());
 
-	type = entry.subtype();
+	type = entry->subtype();
 	switch(type) {
 		case A65_TOKEN_DIRECTIVE_DATA_BYTE:
 			a65_tree::move_child(tree, 0);
 
-			entry = parser.token(tree.node().token());
+			entry = &parser.token_ref(tree.node().token());
 			if(!tree.node().match(A65_NODE_LIST)) {
-				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry.to_string()));
+				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
 			}
 
 			for(size_t child = 0; child < tree.node().child_count(); ++child) {
@@ -830,14 +1446,14 @@ a65_assembler::evaluate_directive(
 				a65_tree::move_child(tree, child);
 
 				if(!tree.node().has_child(0)) {
-					A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry.to_string()));
+					A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
 				}
 
 				a65_tree::move_child(tree, 0);
 
-				entry = parser.token(tree.node().token());
-				if((entry.type() == A65_TOKEN_LITERAL) && !tree.node().child_count()) {
-					literal = entry.literal();
+				entry = &parser.token_ref(tree.node().token());
+				if((entry->type() == A65_TOKEN_LITERAL) && !tree.node().child_count()) {
+					literal = entry->literal();
 				}
 
 				a65_tree::move_parent(tree);
@@ -856,9 +1472,9 @@ a65_assembler::evaluate_directive(
 		case A65_TOKEN_DIRECTIVE_DATA_WORD:
 			a65_tree::move_child(tree, 0);
 
-			entry = parser.token(tree.node().token());
+			entry = &parser.token_ref(tree.node().token());
 			if(!tree.node().match(A65_NODE_LIST)) {
-				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry.to_string()));
+				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
 			}
 
 			for(size_t child = 0; child < tree.node().child_count(); ++child) {
@@ -867,14 +1483,14 @@ a65_assembler::evaluate_directive(
 				a65_tree::move_child(tree, child);
 
 				if(!tree.node().has_child(0)) {
-					A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry.to_string()));
+					A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
 				}
 
 				a65_tree::move_child(tree, 0);
 
-				entry = parser.token(tree.node().token());
-				if((entry.type() == A65_TOKEN_LITERAL) && !tree.node().child_count()) {
-					literal = entry.literal();
+				entry = &parser.token_ref(tree.node().token());
+				if((entry->type() == A65_TOKEN_LITERAL) && !tree.node().child_count()) {
+					literal = entry->literal();
 				}
 
 				a65_tree::move_parent(tree);
@@ -906,31 +1522,31 @@ a65_assembler::evaluate_directive(
 
 			a65_tree::move_child(tree, 0);
 
-			entry = parser.token(tree.node().token());
-			if(!entry.match(A65_TOKEN_IDENTIFIER)) {
-				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry.to_string()));
+			entry = &parser.token_ref(tree.node().token());
+			if(!entry->match(A65_TOKEN_IDENTIFIER)) {
+				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
 			}
 
-			add_define(entry, value);
+			add_define(*entry, value);
 			a65_tree::move_parent(tree);
 			break;
 		case A65_TOKEN_DIRECTIVE_EXPORT:
 			a65_tree::move_child(tree, 0);
 
-			entry = parser.token(tree.node().token());
-			if(!entry.match(A65_TOKEN_IDENTIFIER)) {
-				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry.to_string()));
+			entry = &parser.token_ref(tree.node().token());
+			if(!entry->match(A65_TOKEN_IDENTIFIER)) {
+				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
 			}
 
-			add_export(entry);
+			add_export(*entry);
 			a65_tree::move_parent(tree);
 			break;
 		case A65_TOKEN_DIRECTIVE_IF:
 			a65_tree::move_child(tree, 0);
-			entry = parser.token(tree.node().token());
+			entry = &parser.token_ref(tree.node().token());
 
 			if(!tree.node().match(A65_NODE_CONDITION)) {
-				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry.to_string()));
+				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
 			}
 
 			branch = evaluate_condition(parser, tree);
@@ -938,31 +1554,31 @@ a65_assembler::evaluate_directive(
 
 			if(branch) {
 				a65_tree::move_child(tree, 1);
-				result = evaluate_list(parser, tree);
+				evaluate_list(parser, tree, result);
 				a65_tree::move_parent(tree);
 			} else {
 
 				for(size_t child = 2; child < tree.node().child_count(); ++child) {
 					a65_tree::move_child(tree, child);
 
-					entry = parser.token(tree.node().token());
-					if(entry.match(A65_TOKEN_DIRECTIVE, A65_TOKEN_DIRECTIVE_ELSE_IF)) {
+					entry = &parser.token_ref(tree.node().token());
+					if(entry->match(A65_TOKEN_DIRECTIVE, A65_TOKEN_DIRECTIVE_ELSE_IF)) {
 						a65_tree::move_child(tree, 0);
 						branch = evaluate_condition(parser, tree);
 						a65_tree::move_parent(tree);
 
 						if(branch) {
 							a65_tree::move_child(tree, 1);
-							result = evaluate_list(parser, tree);
+							evaluate_list(parser, tree, result);
 							a65_tree::move_parent(tree);
 						}
-					} else if(entry.match(A65_TOKEN_DIRECTIVE, A65_TOKEN_DIRECTIVE_ELSE)) {
+					} else if(entry->match(A65_TOKEN_DIRECTIVE, A65_TOKEN_DIRECTIVE_ELSE)) {
 						branch = true;
 						a65_tree::move_child(tree, 0);
-						result = evaluate_list(parser, tree);
+						evaluate_list(parser, tree, result);
 						a65_tree::move_parent(tree);
 					} else {
-						A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry.to_string()));
+						A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
 					}
 
 					a65_tree::move_parent(tree);
@@ -977,12 +1593,12 @@ a65_assembler::evaluate_directive(
 		case A65_TOKEN_DIRECTIVE_IF_DEFINE_NOT:
 			a65_tree::move_child(tree, 0);
 
-			entry = parser.token(tree.node().token());
-			if(!entry.match(A65_TOKEN_IDENTIFIER)) {
-				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry.to_string()));
+			entry = &parser.token_ref(tree.node().token());
+			if(!entry->match(A65_TOKEN_IDENTIFIER)) {
+				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
 			}
 
-			branch = contains_define(entry.literal());
+			branch = contains_define(entry->symbol());
 			a65_tree::move_parent(tree);
 
 			if(type == A65_TOKEN_DIRECTIVE_IF_DEFINE_NOT) {
@@ -991,17 +1607,17 @@ a65_assembler::evaluate_directive(
 
 			if(branch) {
 				a65_tree::move_child(tree, 1);
-				result = evaluate_list(parser, tree);
+				evaluate_list(parser, tree, result);
 				a65_tree::move_parent(tree);
 			} else if(tree.has_child(2)) {
 				a65_tree::move_child(tree, 2);
 
 				if(!tree.has_child(0)) {
-					A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry.to_string()));
+					A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
 				}
 
 				a65_tree::move_child(tree, 0);
-				result = evaluate_list(parser, tree);
+				evaluate_list(parser, tree, result);
 				a65_tree::move_parent(tree);
 				a65_tree::move_parent(tree);
 			}
@@ -1014,26 +1630,32 @@ a65_assembler::evaluate_directive(
 			break;
 		case A65_TOKEN_DIRECTIVE_RESERVE:
 			a65_tree::move_child(tree, 0);
-			result.resize(evaluate_expression(parser, tree), A65_ASSEMBLER_FILL_RESERVE);
+
+			value = evaluate_expression(parser, tree);
+			if(value >= A65_ASSEMBLER_FILL_RESERVE_MIN) {
+				m_fill.push_back({ (uint32_t) result.size(), value, A65_ASSEMBLER_FILL_RESERVE });
+			} else {
+				result.insert(result.end(), value, A65_ASSEMBLER_FILL_RESERVE);
+			}
+
 			a65_tree::move_parent(tree);
 			break;
 		case A65_TOKEN_DIRECTIVE_UNDEFINE:
 			a65_tree::move_child(tree, 0);
 
-			entry = parser.token(tree.node().token());
-			if(!entry.match(A65_TOKEN_IDENTIFIER)) {
-				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry.to_string()));
+			entry = &parser.token_ref(tree.node().token());
+			if(!entry->match(A65_TOKEN_IDENTIFIER)) {
+				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
 			}
 
-			remove_define(entry);
+			remove_define(*entry);
 			a65_tree::move_parent(tree);
 			break;
 		default:
-			A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry.to_string()));
+			A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
 	}
 
 	A65_DEBUG_EXIT();
-	return result;
 }
 
 uint16_t
@@ -1042,341 +1664,1393 @@ a65_assembler::evaluate_expression(
 	__in a65_tree &tree
 	)
 {
-	a65_token entry;
-	std::string literal;
-	uint16_t left, result = 0, right;
+	uint16_t *stack, result = 0;
+	const a65_symbol_entry_t *symbol = nullptr;
+	a65_assembler_instruction_t *instruction = nullptr, *instruction_end = nullptr;
 
 	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
 
-	entry = parser.token(tree.node().token());
+	const a65_assembler_expression_t &expression = find_expression(parser, tree);
 
-	switch(tree.node().type()) {
-		case A65_NODE_EXPRESSION:
-			a65_tree::move_child(tree, 0);
-			result = evaluate_expression(parser, tree);
-			a65_tree::move_parent(tree);
-			break;
-		case A65_NODE_CONSTANT:
+	if(m_expression_stack.size() < expression.depth) {
+		m_expression_stack.resize(expression.depth);
+	}
 
-			switch(entry.type()) {
-				case A65_TOKEN_CONSTANT:
+	stack = m_expression_stack.data();
+	instruction = (m_expression_code.data() + expression.offset);
+	instruction_end = (instruction + expression.length);
 
-					switch(entry.subtype()) {
-						case A65_TOKEN_CONSTANT_FALSE:
-							result = false;
-							break;
-						case A65_TOKEN_CONSTANT_NULL:
-							result = (uint16_t)NULL;
-							break;
-						case A65_TOKEN_CONSTANT_TRUE:
-							result = true;
-							break;
-						default:
-							A65_THROW_EXCEPTION_INFO("Malformed expression tree", "%s",
-											A65_STRING_CHECK(entry.to_string()));
-					}
-					break;
-				case A65_TOKEN_IDENTIFIER:
-					literal = entry.literal();
-
-					if(contains_define(literal)) {
-						result = find_define(literal)->second;
-					} else if(contains_label(literal)) {
-						result = find_label(literal)->second;
-					} else if(!m_second_pass) {
-						result = UINT16_MAX;
-					} else {
-						A65_THROW_EXCEPTION_INFO("Undefined operand", "%s", A65_STRING_CHECK(entry.to_string()));
-					}
-					break;
-				case A65_TOKEN_LITERAL:
-					literal = entry.literal();
+	for(; instruction != instruction_end; ++instruction) {
 
-					if(tree.node().has_child(0)) {
-						uint16_t index;
+		switch(instruction->opcode) {
+			case A65_ASSEMBLER_OPCODE_CONSTANT:
+				*stack++ = instruction->value;
+				break;
+			case A65_ASSEMBLER_OPCODE_LITERAL:
 
-						a65_tree::move_child(tree, 0);
-						index = evaluate_expression(parser, tree);
-						a65_tree::move_parent(tree);
+				if(stack[-1] >= instruction->value) {
+					A65_THROW_EXCEPTION_INFO("Literal out-of-range", "%s",
+						A65_STRING_CHECK(parser.token_ref(instruction->token).to_string()));
+				}
 
-						if(index >= literal.size()) {
-							A65_THROW_EXCEPTION_INFO("Literal out-of-range", "%s", A65_STRING_CHECK(entry.to_string()));
-						}
+				stack[-1] = m_expression_literal[instruction->literal + stack[-1]];
+				break;
+			case A65_ASSEMBLER_OPCODE_MACRO:
+				stack[-1] = evaluate_macro(instruction->subtype, stack[-1]);
+				break;
+			case A65_ASSEMBLER_OPCODE_OPERATOR:
+				--stack;
 
-						result = literal.at(index);
-					} else {
-						result = literal.front();
-					}
-					break;
-				case A65_TOKEN_SCALAR:
-					result = entry.scalar();
-					break;
-				default:
-					A65_THROW_EXCEPTION_INFO("Malformed expression tree", "%s", A65_STRING_CHECK(entry.to_string()));
-			}
-			break;
-		case A65_NODE_MACRO:
-			a65_tree::move_child(tree, 0);
-			result = evaluate_expression(parser, tree);
-			a65_tree::move_parent(tree);
+				if(!*stack && A65_IS_TOKEN_SYMBOL_DIVISION(instruction->subtype)) {
+					A65_THROW_EXCEPTION_INFO("Division by zero", "%s",
+						A65_STRING_CHECK(parser.token_ref(instruction->token).to_string()));
+				}
 
-			switch(entry.subtype()) {
-				case A65_TOKEN_MACRO_HIGH:
-					result >>= CHAR_BIT;
-					break;
-				case A65_TOKEN_MACRO_LOW:
-					result &= UINT8_MAX;
-					break;
-				default:
-					A65_THROW_EXCEPTION_INFO("Malformed expression tree", "%s", A65_STRING_CHECK(entry.to_string()));
-			}
-			break;
-		case A65_NODE_OPERATOR:
-			a65_tree::move_child(tree, 0);
-			left = evaluate_expression(parser, tree);
-			a65_tree::move_parent(tree);
+				stack[-1] = evaluate_operator(instruction->subtype, stack[-1], *stack);
+				break;
+			case A65_ASSEMBLER_OPCODE_SYMBOL:
 
-			a65_tree::move_child(tree, 1);
-			right = evaluate_expression(parser, tree);
-			a65_tree::move_parent(tree);
+				if(!m_symbol.match(instruction->slot, instruction->symbol)) {
+					instruction->slot = m_symbol.insert(instruction->symbol);
+				}
 
-			switch(entry.subtype()) {
-				case A65_TOKEN_SYMBOL_ARITHMETIC_ADDITION:
-					result = (left + right);
-					break;
-				case A65_TOKEN_SYMBOL_ARITHMETIC_DIVIDE:
-					result = (left / right);
-					break;
-				case A65_TOKEN_SYMBOL_ARITHMETIC_MODULUS:
-					result = (left % right);
-					break;
-				case A65_TOKEN_SYMBOL_ARITHMETIC_MULTIPLY:
-					result = (left * right);
-					break;
-				case A65_TOKEN_SYMBOL_ARITHMETIC_SUBTRACTION:
-					result = (left - right);
-					break;
-				case A65_TOKEN_SYMBOL_BINARY_AND:
-					result = (left & right);
-					break;
-				case A65_TOKEN_SYMBOL_BINARY_OR:
-					result = (left | right);
-					break;
-				case A65_TOKEN_SYMBOL_BINARY_XOR:
-					result = (left ^ right);
-					break;
-				case A65_TOKEN_SYMBOL_LOGICAL_AND:
-					result = (left && right);
-					break;
-				case A65_TOKEN_SYMBOL_LOGICAL_OR:
-					result = (left || right);
-					break;
-				case A65_TOKEN_SYMBOL_LOGICAL_SHIFT_LEFT:
-					result = (left << right);
-					break;
-				case A65_TOKEN_SYMBOL_LOGICAL_SHIFT_RIGHT:
-					result = (left >> right);
-					break;
-				default:
-					A65_THROW_EXCEPTION_INFO("Malformed expression tree", "%s", A65_STRING_CHECK(entry.to_string()));
-			}
-			break;
-		case A65_NODE_UNARY:
-			a65_tree::move_child(tree, 0);
-			result = evaluate_expression(parser, tree);
-			a65_tree::move_parent(tree);
+				symbol = &m_symbol.entry(instruction->slot);
+				if(!evaluate_symbol(*symbol, *stack)) {
+					A65_THROW_EXCEPTION_INFO("Undefined operand", "%s",
+						A65_STRING_CHECK(parser.token_ref(instruction->token).to_string()));
+				}
 
-			switch(entry.subtype()) {
-				case A65_TOKEN_SYMBOL_UNARY_NEGATION:
-					result = ~result;
-					break;
-				case A65_TOKEN_SYMBOL_UNARY_NOT:
-					result = !result;
-					break;
-				default:
-					A65_THROW_EXCEPTION_INFO("Malformed expression tree", "%s", A65_STRING_CHECK(entry.to_string()));
-			}
-			break;
-		default:
-			A65_THROW_EXCEPTION_INFO("Malformed expression tree", "%s", A65_STRING_CHECK(entry.to_string()));
+				if(m_dependency_record) {
+					m_dependency.push_back({ instruction->slot, *stack });
+				}
+
+				++stack;
+				break;
+			case A65_ASSEMBLER_OPCODE_UNARY:
+				stack[-1] = evaluate_unary(instruction->subtype, stack[-1]);
+				break;
+			default:
+				A65_THROW_EXCEPTION_INFO("Malformed expression", "%u(%x)", instruction->opcode, instruction->opcode);
+		}
 	}
 
+	result = m_expression_stack.front();
+
 	A65_DEBUG_EXIT_INFO("Result=%u(%04x)", result, result);
 	return result;
 }
 
-std::vector<uint8_t>
-a65_assembler::evaluate_list(
+void
+a65_assembler::evaluate_include(
 	__in a65_parser &parser,
-	__in a65_tree &tree
+	__inout std::vector<uint8_t> &result
 	)
 {
-	std::vector<uint8_t> result;
 
-	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
+	A65_DEBUG_ENTRY_INFO("Parser=%p", &parser);
 
-	for(size_t child = 0; child < tree.node().child_count(); ++child) {
-		std::vector<uint8_t> data;
+	parser.reset();
 
-		a65_tree::move_child(tree, child);
-		data = evaluate(parser, tree);
-		a65_tree::move_parent(tree);
+	while(parser.has_next()) {
+		a65_tree &tree = parser.tree_ref();
 
-		if(!data.empty()) {
-			result.insert(result.end(), data.begin(), data.end());
+		if(!tree.node().match(A65_NODE_BEGIN)
+				&& !tree.node().match(A65_NODE_END)) {
+			evaluate(parser, tree, result);
 		}
+
+		parser.move_next();
 	}
 
 	A65_DEBUG_EXIT();
-	return result;
 }
 
-std::vector<uint8_t>
-a65_assembler::evaluate_pragma(
-	__in a65_parser &parser,
-	__in a65_tree &tree
+void
+a65_assembler::evaluate_include_define(
+	__in const a65_assembler &include
 	)
 {
-	uint16_t line;
-	a65_token entry;
-	std::string path;
-	std::vector<uint8_t> result;
+	std::vector<std::pair<uint32_t, uint16_t>>::const_iterator entry;
 
-	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
+	A65_DEBUG_ENTRY_INFO("Include=%p", &include);
 
-	entry = parser.token(tree.node().token());
-	switch(entry.subtype()) {
-		case A65_TOKEN_PRAGMA_INCLUDE_BINARY:
-		case A65_TOKEN_PRAGMA_INCLUDE_SOURCE:
-			A65_THROW_EXCEPTION_INFO("Disallowed pragma", "%s", A65_STRING_CHECK(entry.to_string()));
-			break;
-		case A65_TOKEN_PRAGMA_METADATA:
-			a65_tree::move_child(tree, 0);
+	for(entry = include.m_include_define.begin(); entry != include.m_include_define.end(); ++entry) {
+		add_define(include.token_ref(entry->first), entry->second);
+	}
 
-			entry = parser.token(tree.node().token());
-			if(!entry.match(A65_TOKEN_LITERAL)) {
-				A65_THROW_EXCEPTION_INFO("Malformed pragma tree", "%s", A65_STRING_CHECK(entry.to_string()));
-			}
+	A65_DEBUG_EXIT();
+}
+
+bool
+a65_assembler::evaluate_include_guard(
+	__in const a65_assembler &include
+	)
+{
+	bool result = true;
+
+	A65_DEBUG_ENTRY_INFO("Include=%p", &include);
+
+	if((include.m_include_guard != A65_INTERN_INVALID) && contains_define(include.m_include_guard)) {
+		result = false;
+	} else if(include.m_include_once && !include.m_include_identity.empty()) {
+		result = m_include_evaluated.insert(include.m_include_identity).second;
+	}
+
+	if(result && !include.m_include_define.empty()) {
+		evaluate_include_define(include);
+		result = false;
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%x", result);
+	return result;
+}
+
+void
+a65_assembler::evaluate_layout(void)
+{
+	size_t pass = 0;
+	uint32_t slot = A65_SYMBOL_INVALID;
+
+	A65_DEBUG_ENTRY();
+
+	m_symbol.clear(A65_SYMBOL_LABEL);
+
+	do {
+
+		if(pass == A65_ASSEMBLER_LAYOUT_PASS_MAX) {
+			const a65_symbol_entry_t &entry = m_symbol.entry(slot);
+			const std::string &name = a65_intern::instance().find(entry.id);
+
+			A65_THROW_EXCEPTION_INFO("Layout did not converge", "%u passes, [%u]%s (%u(%04x) -> %u(%04x))", pass, name.size(),
+				A65_STRING_CHECK(name), entry.value[A65_SYMBOL_LABEL_ESTIMATE], entry.value[A65_SYMBOL_LABEL_ESTIMATE],
+				entry.value[A65_SYMBOL_LABEL], entry.value[A65_SYMBOL_LABEL]);
+		}
+
+		m_symbol.copy(A65_SYMBOL_LABEL, A65_SYMBOL_LABEL_ESTIMATE);
+		m_forward = false;
+		a65_assembler::clear();
+		evaluate(*this);
+		++pass;
+	} while(m_forward && ((slot = m_symbol.compare(A65_SYMBOL_LABEL, A65_SYMBOL_LABEL_ESTIMATE)) != A65_SYMBOL_INVALID));
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_assembler::evaluate_list(
+	__in a65_parser &parser,
+	__in a65_tree &tree,
+	__inout std::vector<uint8_t> &result
+	)
+{
+
+	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
+
+	for(size_t child = 0; child < tree.node().child_count(); ++child) {
+		a65_tree::move_child(tree, child);
+		evaluate(parser, tree, result);
+		a65_tree::move_parent(tree);
+	}
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_assembler::evaluate_pragma(
+	__in a65_parser &parser,
+	__in a65_tree &tree,
+	__inout std::vector<uint8_t> &result
+	)
+{
+	uint16_t line;
+	const a65_token *entry = nullptr;
+	std::string path;
+	a65_assembler *include = nullptr;
+	const a65_buffer *data = nullptr;
+
+	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
+
+	entry = &parser.token_ref(tree.node().token());
+	switch(entry->subtype()) {
+		case A65_TOKEN_PRAGMA_INCLUDE_BINARY:
+			data = find_include_binary(entry->id())->second.get();
+			result.insert(result.end(), (const uint8_t *)data->data(), (const uint8_t *)data->data() + data->length());
+			break;
+		case A65_TOKEN_PRAGMA_INCLUDE_SOURCE:
+
+			if(!contains_include(entry->id())) {
+				A65_THROW_EXCEPTION_INFO("Include not found", "%s", A65_STRING_CHECK(entry->to_string()));
+			}
+
+			include = &find_include(entry->id())->second;
+
+			if(evaluate_include_guard(*include)) {
+				evaluate_include(*include, result);
+			}
+			break;
+		case A65_TOKEN_PRAGMA_METADATA:
+			a65_tree::move_child(tree, 0);
+
+			entry = &parser.token_ref(tree.node().token());
+			if(!entry->match(A65_TOKEN_LITERAL)) {
+				A65_THROW_EXCEPTION_INFO("Malformed pragma tree", "%s", A65_STRING_CHECK(entry->to_string()));
+			}
 
-			path = entry.literal();
+			path = entry->literal();
 			a65_tree::move_parent(tree);
 
 			a65_tree::move_child(tree, 1);
 
-			entry = parser.token(tree.node().token());
-			if(!entry.match(A65_TOKEN_SCALAR)) {
-				A65_THROW_EXCEPTION_INFO("Malformed pragma tree", "%s", A65_STRING_CHECK(entry.to_string()));
+			entry = &parser.token_ref(tree.node().token());
+			if(!entry->match(A65_TOKEN_SCALAR)) {
+				A65_THROW_EXCEPTION_INFO("Malformed pragma tree", "%s", A65_STRING_CHECK(entry->to_string()));
 			}
 
-			line = entry.scalar();
+			line = entry->scalar();
 			a65_tree::move_parent(tree);
 			a65_lexer::set_metadata(path, line);
 			break;
+		case A65_TOKEN_PRAGMA_ONCE:
+			break;
 		default:
-			A65_THROW_EXCEPTION_INFO("Malformed pragma tree", "%s", A65_STRING_CHECK(entry.to_string()));
+			A65_THROW_EXCEPTION_INFO("Malformed pragma tree", "%s", A65_STRING_CHECK(entry->to_string()));
 	}
 
 	A65_DEBUG_EXIT();
+}
+
+size_t
+a65_assembler::evaluate_size(
+	__in a65_parser &parser,
+	__in a65_tree &tree
+	)
+{
+	size_t result = 0;
+
+	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
+
+	const a65_token &entry = parser.token_ref(tree.node().token());
+	switch(entry.type()) {
+		case A65_TOKEN_COMMAND:
+			result = evaluate_size_command(parser, tree);
+			break;
+		case A65_TOKEN_DIRECTIVE:
+			result = evaluate_size_directive(parser, tree);
+			break;
+		case A65_TOKEN_LABEL:
+			add_label(entry, m_origin + m_offset);
+			break;
+		case A65_TOKEN_PRAGMA:
+			result = evaluate_size_pragma(parser, tree);
+			break;
+		default:
+			A65_THROW_EXCEPTION_INFO("Malformed tree", "%s", A65_STRING_CHECK(entry.to_string()));
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
 	return result;
 }
 
-std::map<std::string, uint16_t>::iterator
-a65_assembler::find_define(
-	__in const std::string &name
+size_t
+a65_assembler::evaluate_size_command(
+	__in a65_parser &parser,
+	__in a65_tree &tree
 	)
 {
-	std::map<std::string, uint16_t>::iterator result;
+	int mode, type, zeropage;
+	uint16_t operand;
+	size_t result = 1;
 
-	A65_DEBUG_ENTRY_INFO("Name[%u]=%s", name.size(), A65_STRING_CHECK(name));
+	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
+
+	const a65_token &entry = parser.token_ref(tree.node().token());
+	if(!entry.match(A65_TOKEN_COMMAND)) {
+		A65_THROW_EXCEPTION_INFO("Malformed command tree", "%s", A65_STRING_CHECK(entry.to_string()));
+	}
+
+	mode = entry.mode();
+	type = entry.subtype();
+
+	if(type != A65_TOKEN_COMMAND_CMD) {
+
+		if((mode < 0) || (mode > A65_TOKEN_COMMAND_MODE_MAX)) {
+			A65_THROW_EXCEPTION_INFO("Malformed command tree", "%s", A65_STRING_CHECK(entry.to_string()));
+		}
+
+		if(!A65_IS_TOKEN_COMMAND_ENCODED(type, mode)) {
+			A65_THROW_EXCEPTION_INFO("Unsupported addressing mode", "%s", A65_STRING_CHECK(entry.to_string()));
+		}
+
+		result = A65_ASSEMBLER_COMMAND_MODE_LENGTH(mode);
+
+		zeropage = A65_ASSEMBLER_COMMAND_MODE_ZEROPAGE(mode);
+		if((zeropage != mode) && A65_IS_TOKEN_COMMAND_ENCODED(type, zeropage)) {
+			a65_tree::move_child(tree, 0);
+			operand = evaluate_expression(parser, tree);
+			a65_tree::move_parent(tree);
+
+			if(operand <= UINT8_MAX) {
+				result = A65_ASSEMBLER_COMMAND_MODE_LENGTH(zeropage);
+			}
+
+			result = evaluate_size_layout(tree, result);
+		} else if(m_relax && (mode == A65_TOKEN_COMMAND_MODE_RELATIVE) && A65_IS_ASSEMBLER_BRANCH_RELAXABLE(type)) {
+			a65_tree::move_child(tree, 0);
+			operand = evaluate_expression(parser, tree);
+			a65_tree::move_parent(tree);
+
+			if(!A65_IS_ASSEMBLER_BRANCH_DISPLACEMENT(evaluate_branch(type, operand))) {
+				result = A65_ASSEMBLER_BRANCH_RELAXED_LENGTH(type);
+			}
 
-	result = m_define.find(name);
-	if(result == m_define.end()) {
-		A65_THROW_EXCEPTION_INFO("Define not found", "%s", A65_STRING_CHECK(name));
+			result = evaluate_size_layout(tree, result);
+		}
+	} else if(tree.node().has_child(0)) {
+		a65_tree::move_child(tree, 0);
+		operand = evaluate_expression(parser, tree);
+		a65_tree::move_parent(tree);
+		result = evaluate_size_layout(tree, result + ((operand <= UINT8_MAX) ? sizeof(uint8_t) : sizeof(uint16_t)));
 	}
 
-	A65_DEBUG_EXIT_INFO("Result={[%u]%s, %u(%04x)}", result->first.size(), A65_STRING_CHECK(result->first), result->second, result->second);
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
 	return result;
 }
 
-std::map<std::string, uint16_t>::iterator
-a65_assembler::find_label(
-	__in const std::string &name
+size_t
+a65_assembler::evaluate_size_directive(
+	__in a65_parser &parser,
+	__in a65_tree &tree
 	)
 {
-	std::map<std::string, uint16_t>::iterator result;
+	int type;
+	const a65_token *entry = nullptr;
+	bool branch = false;
+	size_t result = 0;
+	std::vector<uint8_t> data;
 
-	A65_DEBUG_ENTRY_INFO("Name[%u]=%s", name.size(), A65_STRING_CHECK(name));
+	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
+
+	entry = &parser.token_ref(tree.node().token());
+
+	type = entry->subtype();
+	switch(type) {
+		case A65_TOKEN_DIRECTIVE_DATA_BYTE:
+		case A65_TOKEN_DIRECTIVE_DATA_WORD:
+			a65_tree::move_child(tree, 0);
+
+			entry = &parser.token_ref(tree.node().token());
+			if(!tree.node().match(A65_NODE_LIST)) {
+				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
+			}
+
+			for(size_t child = 0; child < tree.node().child_count(); ++child) {
+				size_t length = 1;
+
+				a65_tree::move_child(tree, child);
+
+				if(!tree.node().has_child(0)) {
+					A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
+				}
+
+				a65_tree::move_child(tree, 0);
+
+				entry = &parser.token_ref(tree.node().token());
+				if((entry->type() == A65_TOKEN_LITERAL) && !tree.node().child_count() && !entry->literal().empty()) {
+					length = entry->literal().size();
+				}
+
+				a65_tree::move_parent(tree);
+				a65_tree::move_parent(tree);
+				result += ((type == A65_TOKEN_DIRECTIVE_DATA_WORD) ? (length * sizeof(uint16_t)) : length);
+			}
+
+			a65_tree::move_parent(tree);
+			break;
+		case A65_TOKEN_DIRECTIVE_IF:
+			a65_tree::move_child(tree, 0);
+			entry = &parser.token_ref(tree.node().token());
+
+			if(!tree.node().match(A65_NODE_CONDITION)) {
+				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
+			}
+
+			branch = evaluate_condition(parser, tree);
+			a65_tree::move_parent(tree);
+
+			if(branch) {
+				a65_tree::move_child(tree, 1);
+				result = evaluate_size_list(parser, tree);
+				a65_tree::move_parent(tree);
+			} else {
+
+				for(size_t child = 2; child < tree.node().child_count(); ++child) {
+					a65_tree::move_child(tree, child);
+
+					entry = &parser.token_ref(tree.node().token());
+					if(entry->match(A65_TOKEN_DIRECTIVE, A65_TOKEN_DIRECTIVE_ELSE_IF)) {
+						a65_tree::move_child(tree, 0);
+						branch = evaluate_condition(parser, tree);
+						a65_tree::move_parent(tree);
+
+						if(branch) {
+							a65_tree::move_child(tree, 1);
+							result = evaluate_size_list(parser, tree);
+							a65_tree::move_parent(tree);
+						}
+					} else if(entry->match(A65_TOKEN_DIRECTIVE, A65_TOKEN_DIRECTIVE_ELSE)) {
+						branch = true;
+						a65_tree::move_child(tree, 0);
+						result = evaluate_size_list(parser, tree);
+						a65_tree::move_parent(tree);
+					} else {
+						A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
+					}
+
+					a65_tree::move_parent(tree);
+
+					if(branch) {
+						break;
+					}
+				}
+			}
+			break;
+		case A65_TOKEN_DIRECTIVE_IF_DEFINE:
+		case A65_TOKEN_DIRECTIVE_IF_DEFINE_NOT:
+			a65_tree::move_child(tree, 0);
+
+			entry = &parser.token_ref(tree.node().token());
+			if(!entry->match(A65_TOKEN_IDENTIFIER)) {
+				A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
+			}
+
+			branch = contains_define(entry->symbol());
+			a65_tree::move_parent(tree);
+
+			if(type == A65_TOKEN_DIRECTIVE_IF_DEFINE_NOT) {
+				branch = !branch;
+			}
+
+			if(branch) {
+				a65_tree::move_child(tree, 1);
+				result = evaluate_size_list(parser, tree);
+				a65_tree::move_parent(tree);
+			} else if(tree.has_child(2)) {
+				a65_tree::move_child(tree, 2);
 
-	result = m_label.find(name);
-	if(result == m_label.end()) {
-		A65_THROW_EXCEPTION_INFO("Label not found", "%s", A65_STRING_CHECK(name));
+				if(!tree.has_child(0)) {
+					A65_THROW_EXCEPTION_INFO("Malformed directive tree", "%s", A65_STRING_CHECK(entry->to_string()));
+				}
+
+				a65_tree::move_child(tree, 0);
+				result = evaluate_size_list(parser, tree);
+				a65_tree::move_parent(tree);
+				a65_tree::move_parent(tree);
+			}
+			break;
+		case A65_TOKEN_DIRECTIVE_RESERVE:
+			a65_tree::move_child(tree, 0);
+			result = evaluate_expression(parser, tree);
+			a65_tree::move_parent(tree);
+			break;
+		default:
+			evaluate_directive(parser, tree, data);
+			break;
 	}
 
-	A65_DEBUG_EXIT_INFO("Result={[%u]%s, %u(%04x)}", result->first.size(), A65_STRING_CHECK(result->first), result->second, result->second);
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
 	return result;
 }
 
-std::map<uint16_t, a65_section>::iterator
-a65_assembler::find_section(
-	__in uint16_t origin
+size_t
+a65_assembler::evaluate_size_include(
+	__in a65_parser &parser
 	)
 {
-	std::map<uint16_t, a65_section>::iterator result;
+	size_t result = 0;
+
+	A65_DEBUG_ENTRY_INFO("Parser=%p", &parser);
+
+	parser.reset();
+
+	while(parser.has_next()) {
+		a65_tree &tree = parser.tree_ref();
+
+		if(!tree.node().match(A65_NODE_BEGIN)
+				&& !tree.node().match(A65_NODE_END)) {
+			result += evaluate_size(parser, tree);
+		}
+
+		parser.move_next();
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+size_t
+a65_assembler::evaluate_size_layout(
+	__in a65_tree &tree,
+	__in size_t length
+	)
+{
+	size_t result = length;
+
+	A65_DEBUG_ENTRY_INFO("Tree=%p, Length=%u", &tree, length);
+
+	a65_assembler_layout_t &layout = find_layout(tree);
+	if(layout.length && (length > layout.length)) {
+		layout.grown = true;
+	} else if(layout.grown) {
+		result = layout.length;
+	}
+
+	layout.length = result;
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+size_t
+a65_assembler::evaluate_size_list(
+	__in a65_parser &parser,
+	__in a65_tree &tree
+	)
+{
+	size_t result = 0;
+
+	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
+
+	for(size_t child = 0; child < tree.node().child_count(); ++child) {
+		a65_tree::move_child(tree, child);
+		result += evaluate_size(parser, tree);
+		a65_tree::move_parent(tree);
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+size_t
+a65_assembler::evaluate_size_pragma(
+	__in a65_parser &parser,
+	__in a65_tree &tree
+	)
+{
+	const a65_token *entry = nullptr;
+	a65_assembler *include = nullptr;
+	size_t result = 0;
+	std::vector<uint8_t> data;
+
+	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
+
+	entry = &parser.token_ref(tree.node().token());
+	switch(entry->subtype()) {
+		case A65_TOKEN_PRAGMA_INCLUDE_BINARY:
+			result = find_include_binary(entry->id())->second->length();
+			break;
+		case A65_TOKEN_PRAGMA_INCLUDE_SOURCE:
+
+			if(!contains_include(entry->id())) {
+				A65_THROW_EXCEPTION_INFO("Include not found", "%s", A65_STRING_CHECK(entry->to_string()));
+			}
+
+			include = &find_include(entry->id())->second;
+
+			if(evaluate_include_guard(*include)) {
+				result = evaluate_size_include(*include);
+			}
+			break;
+		default:
+			evaluate_pragma(parser, tree, data);
+			break;
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+bool
+a65_assembler::evaluate_size_short(
+	__in a65_tree &tree,
+	__in int mode
+	)
+{
+	bool result;
+
+	A65_DEBUG_ENTRY_INFO("Tree=%p, Mode=%u", &tree, mode);
+
+	result = (evaluate_size_layout(tree, A65_ASSEMBLER_COMMAND_MODE_LENGTH(mode)) == A65_ASSEMBLER_COMMAND_MODE_LENGTH(mode));
+
+	A65_DEBUG_EXIT_INFO("Result=%x", result);
+	return result;
+}
+
+bool
+a65_assembler::evaluate_symbol(
+	__in const a65_symbol_entry_t &symbol,
+	__inout uint16_t &value
+	)
+{
+	bool result = true;
+
+	A65_DEBUG_ENTRY_INFO("Symbol={%u(%x), %x}, Value=%p", symbol.id, symbol.id, symbol.flag, &value);
+
+	if(symbol.flag & A65_SYMBOL_FLAG(A65_SYMBOL_DEFINE)) {
+		value = symbol.value[A65_SYMBOL_DEFINE];
+	} else if(symbol.flag & A65_SYMBOL_FLAG(A65_SYMBOL_LABEL)) {
+		value = symbol.value[A65_SYMBOL_LABEL];
+	} else if(!m_second_pass) {
+		m_forward = true;
+		value = (symbol.flag & A65_SYMBOL_FLAG(A65_SYMBOL_LABEL_ESTIMATE)) ? symbol.value[A65_SYMBOL_LABEL_ESTIMATE] : UINT16_MAX;
+	} else {
+		result = false;
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%x, Value=%u(%04x)", result, value, value);
+	return result;
+}
+
+std::string
+a65_assembler::find_build_cache(
+	__in const std::string &key,
+	__in const std::string &text,
+	__in const std::string &name,
+	__in bool header,
+	__in bool source
+	)
+{
+	std::stringstream path;
+	std::string data, object, result;
+	std::vector<std::pair<std::string, std::string>> file;
+	std::vector<std::pair<std::string, std::string>>::iterator entry;
+
+	A65_DEBUG_ENTRY_INFO("Key[%u]=%s, Text[%u]=%p, Name[%u]=%s, Header=%x, Source=%x", key.size(), A65_STRING_CHECK(key), text.size(),
+		&text, name.size(), A65_STRING_CHECK(name), header, source);
+
+	path << m_output;
+
+	if(path.str().back() != A65_ASSEMBLER_OUTPUT_SEPERATOR) {
+		path << A65_ASSEMBLER_OUTPUT_SEPERATOR;
+	}
+
+	path << name;
+	object = path.str() + A65_ASSEMBLER_OUTPUT_OBJECT_EXTENSION;
+	file.push_back(std::make_pair(build_cache_path(key, A65_ASSEMBLER_OUTPUT_OBJECT_EXTENSION), object));
+
+	if(header) {
+		file.push_back(std::make_pair(build_cache_path(key, A65_ASSEMBLER_OUTPUT_OBJECT_EXTENSION A65_ASSEMBLER_OUTPUT_SOURCE_EXTENSION),
+			object + A65_ASSEMBLER_OUTPUT_SOURCE_EXTENSION));
+	}
+
+	if(source) {
+		file.push_back(std::make_pair(build_cache_path(key, A65_ASSEMBLER_OUTPUT_SOURCE_EXTENSION),
+			path.str() + A65_ASSEMBLER_OUTPUT_SOURCE_EXTENSION));
+	}
+
+	file.push_back(std::make_pair(build_cache_path(key, A65_ASSEMBLER_OUTPUT_KEY_EXTENSION), std::string()));
+
+	for(entry = file.begin(); entry != file.end(); ++entry) {
+
+		if(!a65_utility::has_file(entry->first)) {
+			break;
+		}
+	}
+
+	if(entry == file.end()) {
+		a65_utility::read_file(file.back().first, data);
+		file.pop_back();
+	}
+
+	if(!data.empty() && (data == text)) {
+
+		for(entry = file.begin(); entry != file.end(); ++entry) {
+			a65_utility::copy_file(entry->first, entry->second);
+		}
+
+		result = object;
+	}
+
+	A65_DEBUG_EXIT_INFO("Result[%u]=%s", result.size(), A65_STRING_CHECK(result));
+	return result;
+}
+
+std::string
+a65_assembler::find_build_manifest(
+	__in const std::string &manifest,
+	__in const std::string &text,
+	__inout std::string &key_text
+	)
+{
+	std::stringstream stream;
+	size_t key_size = 0, text_size = 0;
+	std::set<std::string> dependency, missing;
+	std::string data, line, path, result;
+
+	A65_DEBUG_ENTRY_INFO("Manifest[%u]=%s, Text[%u]=%p, Key Text=%p", manifest.size(), A65_STRING_CHECK(manifest), text.size(), &text,
+		&key_text);
+
+	path = build_cache_path(manifest, A65_ASSEMBLER_OUTPUT_MANIFEST_EXTENSION);
+
+	if(a65_utility::has_file(path)) {
+		a65_utility::read_file(path, data);
+		stream << data;
+
+		if(std::getline(stream, result) && (stream >> text_size >> key_size) && std::getline(stream, line)) {
+			data.resize(text_size);
+			key_text.resize(key_size);
+
+			if(!stream.read(&data[0], data.size()) || !stream.read(&key_text[0], key_text.size())
+					|| !std::getline(stream, line) || (data != text)) {
+				result.clear();
+			}
+
+			while(!result.empty() && std::getline(stream, line)) {
+				std::stringstream hash;
+				size_t split = line.find(A65_ASSEMBLER_CHARACTER_MANIFEST);
+
+				if(split == std::string::npos) {
+					result.clear();
+				} else {
+					path = line.substr(split + 1);
+
+					if(!line.compare(0, split, A65_ASSEMBLER_MANIFEST_MISSING)) {
+
+						if(a65_utility::has_file(path)) {
+							result.clear();
+						}
+
+						missing.insert(path);
+					} else if(!a65_utility::has_file(path)) {
+						result.clear();
+					} else {
+						a65_utility::read_file(path, data);
+						hash << A65_STRING_HEX(uint64_t, a65_utility::hash(data));
+
+						if(hash.str() != line.substr(0, split)) {
+							result.clear();
+						}
+
+						dependency.insert(path);
+					}
+				}
+			}
+		} else {
+			result.clear();
+		}
+	}
+
+	if(!result.empty()) {
+		m_build_dependency = dependency;
+		m_build_missing = missing;
+	} else {
+		key_text.clear();
+	}
+
+	A65_DEBUG_EXIT_INFO("Result[%u]=%s", result.size(), A65_STRING_CHECK(result));
+	return result;
+}
+
+uint16_t
+a65_assembler::find_define(
+	__in uint32_t id
+	) const
+{
+	uint16_t result;
+
+	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
+
+	if(!m_symbol.contains(A65_SYMBOL_DEFINE, id)) {
+		A65_THROW_EXCEPTION_INFO("Define not found", "%u(%x)", id, id);
+	}
+
+	result = m_symbol.value(A65_SYMBOL_DEFINE, id);
+
+	A65_DEBUG_EXIT_INFO("Result=%u(%04x)", result, result);
+	return result;
+}
+
+const a65_assembler_expression_t &
+a65_assembler::find_expression(
+	__in a65_parser &parser,
+	__in a65_tree &tree
+	)
+{
+	uint32_t slot;
+	int depth = 0;
+	a65_assembler_expression_t *result = nullptr;
+
+	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
+
+	if(!tree.node().match(A65_NODE_EXPRESSION)) {
+		A65_THROW_EXCEPTION_INFO("Malformed expression tree", "%s",
+			A65_STRING_CHECK(parser.token_ref(tree.node().token()).to_string()));
+	}
+
+	slot = tree.node().slot();
+	if((slot >= m_expression.size()) || (m_expression.at(slot).tree != tree.id())) {
+		a65_assembler_expression_t expression = { tree.id(), (uint32_t) m_expression_code.size(), 0, 0 };
+
+		compile_expression(parser, tree);
+		expression.length = (m_expression_code.size() - expression.offset);
+
+		for(uint32_t offset = expression.offset; offset < m_expression_code.size(); ++offset) {
+			depth += A65_ASSEMBLER_OPCODE_STACK_DELTA(m_expression_code.at(offset).opcode);
+			expression.depth = std::max(expression.depth, (uint32_t) depth);
+		}
+
+		slot = m_expression.size();
+		m_expression.push_back(expression);
+		tree.node().set_slot(slot);
+	}
+
+	result = &m_expression.at(slot);
+
+	A65_DEBUG_EXIT_INFO("Result={%u(%x), %u, %u, %u}", result->tree, result->tree, result->offset, result->length,
+		result->depth);
+	return *result;
+}
+
+std::map<uint32_t, a65_assembler>::iterator
+a65_assembler::find_include(
+	__in uint32_t id
+	)
+{
+	std::map<uint32_t, uint32_t>::iterator alias;
+	std::map<uint32_t, a65_assembler>::iterator result;
+
+	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
+
+	alias = m_include_alias.find(id);
+	if(alias != m_include_alias.end()) {
+		id = alias->second;
+	}
+
+	result = m_include.find(id);
+	if(result == m_include.end()) {
+		A65_THROW_EXCEPTION_INFO("Include not found", "%u(%x)", id, id);
+	}
+
+	A65_DEBUG_EXIT_INFO("Result={%u(%x), %p}", result->first, result->first, &result->second);
+	return result;
+}
+
+std::map<uint32_t, std::shared_ptr<const a65_buffer>>::iterator
+a65_assembler::find_include_binary(
+	__in uint32_t id
+	)
+{
+	std::map<uint32_t, std::shared_ptr<const a65_buffer>>::iterator result;
+
+	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
+
+	result = m_include_binary.find(id);
+	if(result == m_include_binary.end()) {
+		A65_THROW_EXCEPTION_INFO("Include not found", "%u(%x)", id, id);
+	}
+
+	A65_DEBUG_EXIT_INFO("Result={%u(%x), %s}", result->first, result->first, A65_STRING_CHECK(result->second->to_string()));
+	return result;
+}
+
+bool
+a65_assembler::find_include_define(
+	__inout std::vector<uint32_t> &token
+	) const
+{
+	bool result = true;
+	std::vector<uint32_t>::const_iterator entry;
+
+	A65_DEBUG_ENTRY_INFO("Token=%p", &token);
+
+	token.clear();
+
+	for(entry = m_tree.begin(); result && (entry != m_tree.end()); ++entry) {
+		a65_tree tree = tree_ref(*entry);
+
+		if(!tree.node().match(A65_NODE_BEGIN)
+				&& !tree.node().match(A65_NODE_END)
+				&& !token_ref(tree.node().token()).match(A65_TOKEN_PRAGMA, A65_TOKEN_PRAGMA_ONCE)) {
+
+			if((m_include_guard != A65_INTERN_INVALID)
+					&& token_ref(tree.node().token()).match(A65_TOKEN_DIRECTIVE, A65_TOKEN_DIRECTIVE_IF_DEFINE_NOT)) {
+				a65_tree::move_child(tree, 1);
+
+				for(size_t child = 0; result && (child < tree.node().child_count()); ++child) {
+					a65_tree::move_child(tree, child);
+					result = find_include_define(tree, token);
+					a65_tree::move_parent(tree);
+				}
+			} else {
+				result = find_include_define(tree, token);
+			}
+		}
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%x, Token[%u]", result, token.size());
+	return result;
+}
+
+bool
+a65_assembler::find_include_define(
+	__inout a65_tree &tree,
+	__inout std::vector<uint32_t> &token
+	) const
+{
+	bool result = false;
+
+	A65_DEBUG_ENTRY_INFO("Tree=%p, Token=%p", &tree, &token);
+
+	if(token_ref(tree.node().token()).match(A65_TOKEN_DIRECTIVE, A65_TOKEN_DIRECTIVE_DEFINE)
+			&& tree.has_child(0)) {
+		a65_tree::move_child(tree, 0);
+		token.push_back(tree.node().token());
+		a65_tree::move_parent(tree);
+		result = true;
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%x", result);
+	return result;
+}
+
+uint16_t
+a65_assembler::find_label(
+	__in uint32_t id
+	) const
+{
+	uint16_t result;
+
+	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
+
+	if(!m_symbol.contains(A65_SYMBOL_LABEL, id)) {
+		A65_THROW_EXCEPTION_INFO("Label not found", "%u(%x)", id, id);
+	}
+
+	result = m_symbol.value(A65_SYMBOL_LABEL, id);
+
+	A65_DEBUG_EXIT_INFO("Result=%u(%04x)", result, result);
+	return result;
+}
+
+a65_assembler_layout_t &
+a65_assembler::find_layout(
+	__in a65_tree &tree
+	)
+{
+	uint32_t slot;
+
+	A65_DEBUG_ENTRY_INFO("Tree=%p", &tree);
+
+	slot = tree.node().slot();
+	if((slot >= m_layout.size()) || (m_layout.at(slot).tree != tree.id())) {
+		slot = m_layout.size();
+		m_layout.push_back({ tree.id(), 0, false });
+		tree.node().set_slot(slot);
+	}
+
+	A65_DEBUG_EXIT_INFO("Result={%u(%x), %u, %x}", m_layout.at(slot).tree, m_layout.at(slot).tree, m_layout.at(slot).length,
+		m_layout.at(slot).grown);
+	return m_layout.at(slot);
+}
+
+std::map<uint16_t, a65_section>::iterator
+a65_assembler::find_section(
+	__in uint16_t origin
+	)
+{
+	std::map<uint16_t, a65_section>::iterator result;
+
+	A65_DEBUG_ENTRY_INFO("Origin=%u(%04x), Name[%u]=%s", origin, origin);
+
+	result = m_section.find(origin);
+	if(result == m_section.end()) {
+		A65_THROW_EXCEPTION_INFO("Section not found", "%u(%04x)", origin, origin);
+	}
+
+	A65_DEBUG_EXIT_INFO("Result={%u(%04x), %p}", result->first, result->first, &result->second);
+	return result;
+}
+
+const a65_symbol_entry_t &
+a65_assembler::find_symbol(
+	__in a65_tree &tree,
+	__in const a65_token &token
+	)
+{
+	uint32_t slot;
+	const a65_symbol_entry_t *result = nullptr;
+
+	A65_DEBUG_ENTRY_INFO("Tree=%p, Token=%p", &tree, &token);
+
+	slot = tree.node().slot();
+	if(!m_symbol.match(slot, token.symbol())) {
+		slot = m_symbol.insert(token.symbol());
+		tree.node().set_slot(slot);
+	}
+
+	result = &m_symbol.entry(slot);
+
+	A65_DEBUG_EXIT_INFO("Result={%u(%x), %x}", result->id, result->id, result->flag);
+	return *result;
+}
+
+std::string
+a65_assembler::form_ihex(
+	__in int type,
+	__in_opt uint16_t origin,
+	__in_opt const std::vector<uint8_t> &data
+	)
+{
+	uint16_t checksum;
+	std::stringstream result;
+	std::vector<uint8_t>::const_iterator entry;
+
+	A65_DEBUG_ENTRY_INFO("Type=%u(%s), Origin=%u(%04x), Data[%u]=%p", type, A65_IHEX_STRING(type), origin, origin, data.size(), &data);
+
+	switch(type) {
+		case A65_IHEX_END:
+
+			if(!data.empty()) {
+				A65_THROW_EXCEPTION_INFO("Data too large", "%u (max=%u)", data.size(), 0);
+			}
+		case A65_IHEX_DATA:
+
+			if(data.size() > UINT8_MAX) {
+				A65_THROW_EXCEPTION_INFO("Data too large", "%u (max=%u)", data.size(), UINT8_MAX);
+			}
+
+			result << A65_IHEX_CHARACTER << A65_STRING_HEX(uint8_t, data.size()) << A65_STRING_HEX(uint16_t, origin)
+				<< A65_STRING_HEX(uint8_t, type);
+
+			checksum = (data.size() + ((origin >> CHAR_BIT) & UINT8_MAX) + (origin & UINT8_MAX) + (type & UINT8_MAX));
+
+			for(entry = data.begin(); entry != data.end(); ++entry) {
+				result << A65_STRING_HEX(uint8_t, *entry);
+				checksum += *entry;
+			}
+
+			result << A65_STRING_HEX(uint8_t, ~(checksum & UINT8_MAX) + 1);
+			break;
+		default:
+			A65_THROW_EXCEPTION_INFO("Unsupported ihex type", "%u(%x)", type, type);
+	}
+
+	A65_DEBUG_EXIT();
+	return result.str();
+}
+
+void
+a65_assembler::insert_build_cache(
+	__in const std::string &key,
+	__in const std::string &text,
+	__in const std::string &name,
+	__in bool header,
+	__in bool source
+	)
+{
+	std::stringstream path;
+	std::vector<std::pair<std::string, std::string>> file;
+	std::vector<std::pair<std::string, std::string>>::iterator entry;
+
+	A65_DEBUG_ENTRY_INFO("Key[%u]=%s, Text[%u]=%p, Name[%u]=%s, Header=%x, Source=%x", key.size(), A65_STRING_CHECK(key), text.size(),
+		&text, name.size(), A65_STRING_CHECK(name), header, source);
+
+	path << m_output;
+
+	if(path.str().back() != A65_ASSEMBLER_OUTPUT_SEPERATOR) {
+		path << A65_ASSEMBLER_OUTPUT_SEPERATOR;
+	}
+
+	path << name;
+
+	if(header) {
+		file.push_back(std::make_pair(path.str() + A65_ASSEMBLER_OUTPUT_OBJECT_EXTENSION A65_ASSEMBLER_OUTPUT_SOURCE_EXTENSION,
+			A65_ASSEMBLER_OUTPUT_OBJECT_EXTENSION A65_ASSEMBLER_OUTPUT_SOURCE_EXTENSION));
+	}
+
+	if(source) {
+		file.push_back(std::make_pair(path.str() + A65_ASSEMBLER_OUTPUT_SOURCE_EXTENSION, A65_ASSEMBLER_OUTPUT_SOURCE_EXTENSION));
+	}
+
+	file.push_back(std::make_pair(path.str() + A65_ASSEMBLER_OUTPUT_OBJECT_EXTENSION, A65_ASSEMBLER_OUTPUT_OBJECT_EXTENSION));
+
+	for(entry = file.begin(); entry != file.end(); ++entry) {
+		std::vector<uint8_t> data;
+
+		a65_utility::read_file(entry->first, data);
+		insert_build_file(build_cache_path(key, entry->second), data);
+	}
+
+	insert_build_file(build_cache_path(key, A65_ASSEMBLER_OUTPUT_KEY_EXTENSION), std::vector<uint8_t>(text.begin(), text.end()));
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_assembler::insert_build_file(
+	__in const std::string &path,
+	__in const std::vector<uint8_t> &data
+	)
+{
+	std::stringstream temporary;
+
+	A65_DEBUG_ENTRY_INFO("Path[%u]=%s, Data[%u]=%p", path.size(), A65_STRING_CHECK(path), data.size(), &data);
+
+	temporary << path << "_" << A65_STRING_HEX(uint32_t, ::getpid())
+		<< "_" << A65_STRING_HEX(size_t, std::hash<std::thread::id>()(std::this_thread::get_id()))
+		<< "_" << A65_STRING_HEX(uint32_t, g_build_file++) << A65_ASSEMBLER_OUTPUT_CACHE_EXTENSION;
+	a65_utility::write_file(temporary.str(), data);
+
+	if(std::rename(temporary.str().c_str(), path.c_str())) {
+		std::vector<uint8_t> existing;
+
+		std::remove(temporary.str().c_str());
+
+		if(!a65_utility::has_file(path) || (a65_utility::read_file(path, existing) != data.size()) || (existing != data)) {
+			A65_THROW_EXCEPTION_INFO("Failed to create file", "[%u]%s", path.size(), A65_STRING_CHECK(path));
+		}
+	}
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_assembler::insert_build_manifest(
+	__in const std::string &manifest,
+	__in const std::string &text,
+	__in const std::string &key,
+	__in const std::string &key_text
+	)
+{
+	std::string data;
+	std::stringstream stream;
+	std::set<std::string>::iterator entry;
+
+	A65_DEBUG_ENTRY_INFO("Manifest[%u]=%s, Text[%u]=%p, Key[%u]=%s, Key Text[%u]=%p", manifest.size(), A65_STRING_CHECK(manifest),
+		text.size(), &text, key.size(), A65_STRING_CHECK(key), key_text.size(), &key_text);
+
+	stream << key << std::endl << text.size() << A65_ASSEMBLER_CHARACTER_MANIFEST << key_text.size()
+		<< std::endl << text << key_text;
+
+	for(entry = m_build_dependency.begin(); entry != m_build_dependency.end(); ++entry) {
+		a65_utility::read_file(*entry, data);
+		stream << std::endl << A65_STRING_HEX(uint64_t, a65_utility::hash(data)) << A65_ASSEMBLER_CHARACTER_MANIFEST << *entry;
+	}
+
+	for(entry = m_build_missing.begin(); entry != m_build_missing.end(); ++entry) {
+		stream << std::endl << A65_ASSEMBLER_MANIFEST_MISSING << A65_ASSEMBLER_CHARACTER_MANIFEST << *entry;
+	}
+
+	data = stream.str();
+	insert_build_file(build_cache_path(manifest, A65_ASSEMBLER_OUTPUT_MANIFEST_EXTENSION),
+		std::vector<uint8_t>(data.begin(), data.end()));
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_assembler::insert_cache(
+	__inout a65_assembler_cache_t &cache,
+	__in size_t length
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Cache=%p, Length=%u", &cache, length);
+
+	if(m_dependency.size() > cache.dependency_capacity) {
+		cache.dependency = m_cache_dependency.size();
+		cache.dependency_capacity = m_dependency.size();
+		m_cache_dependency.resize(cache.dependency + cache.dependency_capacity);
+	}
+
+	std::copy(m_dependency.begin(), m_dependency.end(), m_cache_dependency.begin() + cache.dependency);
+	cache.length = length;
+	cache.dependency_count = m_dependency.size();
+	cache.valid = true;
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_assembler::load_include(
+	__in const std::string &input
+	)
+{
+	std::string name, path = input;
+	a65_snapshot_identity_t identity = {};
+	std::shared_ptr<const a65_snapshot> snapshot;
+	size_t extension = std::string(A65_ASSEMBLER_OUTPUT_PRECOMPILE_EXTENSION).size();
+
+	A65_DEBUG_ENTRY_INFO("Input[%u]=%p", input.size(), &input);
+
+	if((input.size() > extension)
+			&& !input.compare(input.size() - extension, extension, A65_ASSEMBLER_OUTPUT_PRECOMPILE_EXTENSION)) {
+		snapshot = load_include_precompiled(input, path);
+	}
+
+	if(a65_include::identify(path, identity) && !snapshot) {
+		snapshot = a65_snapshot::find(identity);
+	}
+
+	m_input = a65_utility::decompose_file_path(path, name);
+
+	if(snapshot) {
+		a65_parser::import_snapshot(*snapshot, path);
+	} else {
+		a65_parser::load(path);
+
+		while(a65_parser::has_next()) {
+			a65_parser::move_next();
+		}
+
+		a65_parser::reset();
+
+		if(!identity.path.empty()) {
+			std::shared_ptr<a65_snapshot> entry = std::make_shared<a65_snapshot>();
+
+			a65_parser::export_snapshot(*entry);
+			a65_snapshot::insert(identity, entry);
+		}
+	}
+
+	m_build_dependency.insert(input);
+
+	if(path != input) {
+		m_build_dependency.insert(path);
+	}
+
+	m_include_identity = identity.path;
+	load_include_guard();
+	m_include_define.clear();
+
+	if(snapshot && snapshot->define_count()) {
+		load_include_define(*snapshot);
+	}
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_assembler::load_include_define(
+	__in const a65_snapshot &snapshot
+	)
+{
+	std::vector<uint32_t> token;
+
+	A65_DEBUG_ENTRY_INFO("Snapshot=%p", &snapshot);
+
+	if(find_include_define(token) && (token.size() == snapshot.define_count())) {
+
+		for(size_t position = 0; position < token.size(); ++position) {
+			m_include_define.push_back(std::make_pair(token.at(position), snapshot.define(position)));
+		}
+	}
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_assembler::load_include_guard(void)
+{
+	size_t count = 0;
+	a65_tree guard;
+
+	A65_DEBUG_ENTRY();
+
+	m_include_guard = A65_INTERN_INVALID;
+	m_include_once = false;
+
+	for(std::vector<uint32_t>::iterator entry = m_tree.begin(); entry != m_tree.end(); ++entry) {
+		a65_tree &tree = tree_ref(*entry);
+
+		if(!tree.node().match(A65_NODE_BEGIN)
+				&& !tree.node().match(A65_NODE_END)) {
+
+			if(token_ref(tree.node().token()).match(A65_TOKEN_PRAGMA, A65_TOKEN_PRAGMA_ONCE)) {
+				m_include_once = true;
+			} else {
+				guard = tree;
+				++count;
+			}
+		}
+	}
+
+	if((count == 1)
+			&& token_ref(guard.node().token()).match(A65_TOKEN_DIRECTIVE, A65_TOKEN_DIRECTIVE_IF_DEFINE_NOT)
+			&& (guard.node().child_count() == 2)) {
+		uint32_t symbol;
+
+		a65_tree::move_child(guard, 0);
+		symbol = token_ref(guard.node().token()).symbol();
+		a65_tree::move_parent(guard);
+		a65_tree::move_child(guard, 1);
+
+		for(size_t child = 0; child < guard.node().child_count(); ++child) {
+			a65_tree::move_child(guard, child);
+
+			if(token_ref(guard.node().token()).match(A65_TOKEN_DIRECTIVE, A65_TOKEN_DIRECTIVE_DEFINE)
+					&& guard.has_child(0)) {
+				a65_tree::move_child(guard, 0);
+
+				if(token_ref(guard.node().token()).symbol() == symbol) {
+					m_include_guard = symbol;
+				}
 
-	A65_DEBUG_ENTRY_INFO("Origin=%u(%04x), Name[%u]=%s", origin, origin);
+				a65_tree::move_parent(guard);
+			}
 
-	result = m_section.find(origin);
-	if(result == m_section.end()) {
-		A65_THROW_EXCEPTION_INFO("Section not found", "%u(%04x)", origin, origin);
+			a65_tree::move_parent(guard);
+
+			if(m_include_guard != A65_INTERN_INVALID) {
+				break;
+			}
+		}
 	}
 
-	A65_DEBUG_EXIT_INFO("Result={%u(%04x), %p}", result->first, result->first, &result->second);
-	return result;
+	A65_DEBUG_EXIT();
 }
 
-std::string
-a65_assembler::form_ihex(
-	__in int type,
-	__in_opt uint16_t origin,
-	__in_opt const std::vector<uint8_t> &data
+std::shared_ptr<const a65_snapshot>
+a65_assembler::load_include_precompiled(
+	__in const std::string &input,
+	__inout std::string &path
 	)
 {
-	uint16_t checksum;
-	std::stringstream result;
-	std::vector<uint8_t>::const_iterator entry;
+	a65_snapshot_identity_t identity = {}, source = {};
+	std::shared_ptr<const a65_snapshot> result;
 
-	A65_DEBUG_ENTRY_INFO("Type=%u(%s), Origin=%u(%04x), Data[%u]=%p", type, A65_IHEX_STRING(type), origin, origin, data.size(), &data);
+	A65_DEBUG_ENTRY_INFO("Input[%u]=%s, Path=%p", input.size(), A65_STRING_CHECK(input), &path);
 
-	switch(type) {
-		case A65_IHEX_END:
+	if(a65_include::identify(input, identity)) {
+		result = a65_snapshot::find(identity);
+	}
 
-			if(!data.empty()) {
-				A65_THROW_EXCEPTION_INFO("Data too large", "%u (max=%u)", data.size(), 0);
-			}
-		case A65_IHEX_DATA:
+	if(!result) {
+		std::shared_ptr<a65_snapshot> entry = std::make_shared<a65_snapshot>();
 
-			if(data.size() > UINT8_MAX) {
-				A65_THROW_EXCEPTION_INFO("Data too large", "%u (max=%u)", data.size(), UINT8_MAX);
-			}
+		if(entry->read(input)) {
 
-			result << A65_IHEX_CHARACTER << A65_STRING_HEX(uint8_t, data.size()) << A65_STRING_HEX(uint16_t, origin)
-				<< A65_STRING_HEX(uint8_t, type);
+			if(!identity.path.empty()) {
+				a65_snapshot::insert(identity, entry);
+			}
 
-			checksum = (data.size() + ((origin >> CHAR_BIT) & UINT8_MAX) + (origin & UINT8_MAX) + (type & UINT8_MAX));
+			result = entry;
+		} else if(entry->source().path.empty()) {
+			A65_THROW_EXCEPTION_INFO("Precompiled include version mismatch", "[%u]%s", input.size(), A65_STRING_CHECK(input));
+		}
 
-			for(entry = data.begin(); entry != data.end(); ++entry) {
-				result << A65_STRING_HEX(uint8_t, *entry);
-				checksum += *entry;
-			}
+		path = entry->source().path;
+	} else {
+		path = result->source().path;
+	}
 
-			result << A65_STRING_HEX(uint8_t, ~(checksum & UINT8_MAX) + 1);
-			break;
-		default:
-			A65_THROW_EXCEPTION_INFO("Unsupported ihex type", "%u(%x)", type, type);
+	if(result && (!a65_include::identify(path, source)
+			|| (source.size != result->source().size)
+			|| (source.time != result->source().time)
+			|| (source.change != result->source().change))) {
+		result.reset();
 	}
 
-	A65_DEBUG_EXIT();
-	return result.str();
+	A65_DEBUG_EXIT_INFO("Result=%p, Path[%u]=%s", result.get(), path.size(), A65_STRING_CHECK(path));
+	return result;
 }
 
 std::string
@@ -1491,15 +3165,7 @@ a65_assembler::output_binary(
 				size_t position = 0;
 
 				while(object_entry->contains_section(position)) {
-					uint16_t origin;
-					std::vector<uint8_t> object_data;
-
-					origin = object_entry->section(position, object_data);
-
-					for(size_t offset = 0; offset < object_data.size(); ++offset) {
-						data.at(origin + offset) = object_data.at(offset);
-					}
-
+					object_entry->link(position, data);
 					++position;
 				}
 			}
@@ -1578,6 +3244,67 @@ a65_assembler::output_binary_ihex(
 	return result.str();
 }
 
+std::string
+a65_assembler::output_depend(
+	__in const std::string &object
+	)
+{
+	std::stringstream source;
+	std::string result = m_depend_path;
+	std::vector<std::string> path(1, object);
+	std::vector<std::string>::iterator entry;
+	size_t extension = std::string(A65_ASSEMBLER_OUTPUT_OBJECT_EXTENSION).size();
+
+	A65_DEBUG_ENTRY_INFO("Object[%u]=%s", object.size(), A65_STRING_CHECK(object));
+
+	if(result.empty()) {
+		result = object;
+
+		if((result.size() > extension)
+				&& !result.compare(result.size() - extension, extension, A65_ASSEMBLER_OUTPUT_OBJECT_EXTENSION)) {
+			result.erase(result.size() - extension);
+		}
+
+		result += A65_ASSEMBLER_OUTPUT_DEPEND_EXTENSION;
+	}
+
+	path.insert(path.end(), m_build_dependency.begin(), m_build_dependency.end());
+
+	for(entry = path.begin(); entry != path.end(); ++entry) {
+
+		if(entry != path.begin()) {
+			source << " " << A65_CHARACTER_ESCAPE << std::endl << " ";
+		}
+
+		for(std::string::const_iterator ch = entry->begin(); ch != entry->end(); ++ch) {
+
+			switch(*ch) {
+				case '$':
+					source << *ch;
+					break;
+				case ' ':
+				case '#':
+					source << A65_CHARACTER_ESCAPE;
+					break;
+				default:
+					break;
+			}
+
+			source << *ch;
+		}
+
+		if(entry == path.begin()) {
+			source << A65_CHARACTER_LABEL;
+		}
+	}
+
+	source << std::endl;
+	a65_utility::write_file(result, source.str());
+
+	A65_DEBUG_EXIT_INFO("Result[%u]=%s", result.size(), A65_STRING_CHECK(result));
+	return result;
+}
+
 std::string
 a65_assembler::output_object(
 	__in const std::string &name,
@@ -1635,14 +3362,14 @@ a65_assembler::output_object_header(
 		<< std::endl << A65_CHARACTER_COMMENT << " Exports:" << std::endl;
 
 	for(entry = m_export.begin(); entry != m_export.end(); ++entry) {
-		std::map<std::string, uint16_t>::iterator label = find_label(*entry);
+		uint16_t label = find_label(a65_intern::instance().generate(*entry));
 
 		if(entry != m_export.begin()) {
 			source << std::endl;
 		}
 
-		source << std::endl << label->first << A65_CHARACTER_LABEL << " " << A65_TOKEN_COMMAND_STRING(A65_TOKEN_COMMAND_JSR)
-			<< " " << A65_STRING_HEX(uint16_t, label->second);
+		source << std::endl << *entry << A65_CHARACTER_LABEL << " " << A65_TOKEN_COMMAND_STRING(A65_TOKEN_COMMAND_JSR)
+			<< " " << A65_STRING_HEX(uint16_t, label);
 	}
 
 	a65_utility::write_file(result.str(), source.str());
@@ -1651,6 +3378,35 @@ a65_assembler::output_object_header(
 	return result.str();
 }
 
+std::string
+a65_assembler::output_precompile(
+	__in const std::string &name,
+	__in const a65_snapshot &snapshot
+	)
+{
+	std::stringstream result;
+
+	A65_DEBUG_ENTRY_INFO("Name[%u]=%s, Snapshot=%p", name.size(), A65_STRING_CHECK(name), &snapshot);
+
+	result << m_output;
+
+	if(result.str().back() != A65_ASSEMBLER_OUTPUT_SEPERATOR) {
+		result << A65_ASSEMBLER_OUTPUT_SEPERATOR;
+	}
+
+	if(name.empty()) {
+		result << A65_ASSEMBLER_OUTPUT_PRECOMPILE_NAME_DEFAULT << "_" << A65_STRING_HEX(int, std::rand());
+	} else {
+		result << name;
+	}
+
+	result << A65_ASSEMBLER_OUTPUT_PRECOMPILE_EXTENSION;
+	snapshot.write(result.str());
+
+	A65_DEBUG_EXIT_INFO("Result[%u]=%s", result.str().size(), A65_STRING_CHECK(result.str()));
+	return result.str();
+}
+
 std::string
 a65_assembler::output_source(
 	__in const std::string &name,
@@ -1696,6 +3452,70 @@ a65_assembler::output_source(
 	return result.str();
 }
 
+std::string
+a65_assembler::precompile(
+	__in const std::string &input,
+	__in const std::string &output
+	)
+{
+	a65_snapshot snapshot;
+	std::string name, result;
+	std::vector<uint16_t> value;
+	std::vector<uint32_t> token;
+	a65_snapshot_identity_t identity = {};
+
+	A65_DEBUG_ENTRY_INFO("Input[%u]=%p, Output[%u]=%p", input.size(), &input, output.size(), &output);
+
+	a65_include::clear();
+
+	if(!a65_include::identify(input, identity)) {
+		A65_THROW_EXCEPTION_INFO("File not found", "[%u]%s", input.size(), A65_STRING_CHECK(input));
+	}
+
+	a65_utility::decompose_file_path(input, name);
+	preprocess_tree(identity.path);
+	a65_parser::export_snapshot(snapshot);
+	snapshot.set_source(identity);
+	load_include_guard();
+
+	if(find_include_define(token)) {
+		m_second_pass = true;
+
+		try {
+			a65_assembler::clear();
+			evaluate(*this);
+
+			for(std::vector<uint32_t>::iterator entry = token.begin(); entry != token.end(); ++entry) {
+				value.push_back(find_define(token_ref(*entry).symbol()));
+			}
+		} catch(...) {
+			value.clear();
+		}
+
+		m_second_pass = false;
+
+		for(std::vector<uint16_t>::iterator entry = value.begin(); entry != value.end(); ++entry) {
+			snapshot.add_define(*entry);
+		}
+	}
+
+	if(output.empty()) {
+
+		if(!m_input.empty()) {
+			m_output = m_input;
+		} else {
+			m_output = A65_ASSEMBLER_OUTPUT_PATH_DEFAULT;
+		}
+	} else {
+		m_output = output;
+	}
+
+	result = output_precompile(name, snapshot);
+
+	A65_DEBUG_EXIT_INFO("Result[%u]=%s", result.size(), A65_STRING_CHECK(result));
+	return result;
+}
+
 std::string
 a65_assembler::preprocess(
 	__in_opt const std::string &input
@@ -1714,7 +3534,7 @@ a65_assembler::preprocess(
 	}
 
 	while(a65_parser::has_next()) {
-		a65_tree tree = a65_parser::tree();
+		a65_tree &tree = a65_parser::tree_ref();
 
 		if(!tree.node().match(A65_NODE_BEGIN)
 				&& !tree.node().match(A65_NODE_END)) {
@@ -2188,6 +4008,91 @@ a65_assembler::preprocess_expression(
 	return result.str();
 }
 
+void
+a65_assembler::preprocess_include(
+	__in a65_parser &parser,
+	__in a65_tree &tree
+	)
+{
+	a65_token entry, pragma;
+	std::stringstream path;
+	a65_snapshot_identity_t identity = {};
+	std::map<uint32_t, a65_assembler>::iterator include;
+	std::map<std::string, uint32_t>::iterator loaded;
+
+	A65_DEBUG_ENTRY_INFO("Parser=%p, Tree=%p", &parser, &tree);
+
+	if(tree.node().match(A65_NODE_PRAGMA)) {
+		pragma = parser.token(tree.node().token());
+
+		switch(pragma.subtype()) {
+			case A65_TOKEN_PRAGMA_INCLUDE_BINARY:
+				a65_tree::move_child(tree, 0);
+				entry = parser.token(tree.node().token());
+				path << a65_include::resolve(m_input, entry.literal(), m_include_path, m_build_missing);
+				a65_tree::move_parent(tree);
+
+				add_include_binary(pragma, path.str());
+				m_build_dependency.insert(path.str());
+				break;
+			case A65_TOKEN_PRAGMA_INCLUDE_SOURCE:
+				a65_tree::move_child(tree, 0);
+				entry = parser.token(tree.node().token());
+				path << a65_include::resolve(m_input, entry.literal(), m_include_path, m_build_missing);
+				a65_tree::move_parent(tree);
+
+				loaded = m_include_loaded.end();
+				if(a65_include::identify(path.str(), identity)) {
+					loaded = m_include_loaded.find(identity.path);
+				}
+
+				if(loaded != m_include_loaded.end()) {
+					m_include_alias.insert(std::make_pair(pragma.id(), loaded->second));
+				} else {
+					add_include(pragma);
+					include = find_include(pragma.id());
+					include->second.m_include_path = m_include_path;
+					include->second.load_include(path.str());
+
+					if(!include->second.m_include_identity.empty()
+							&& (include->second.m_include_once || (include->second.m_include_guard != A65_INTERN_INVALID))) {
+						m_include_loaded.insert(std::make_pair(include->second.m_include_identity, pragma.id()));
+
+						if(!identity.path.empty()) {
+							m_include_loaded.insert(std::make_pair(identity.path, pragma.id()));
+						}
+					}
+
+					include->second.m_include_loaded = m_include_loaded;
+					include->second.preprocess_tree();
+					m_build_dependency.merge(include->second.m_build_dependency);
+					m_build_missing.merge(include->second.m_build_missing);
+					m_include.merge(include->second.m_include);
+					m_include_alias.merge(include->second.m_include_alias);
+					m_include_binary.merge(include->second.m_include_binary);
+					m_include_loaded = include->second.m_include_loaded;
+				}
+				break;
+			case A65_TOKEN_PRAGMA_METADATA:
+				A65_THROW_EXCEPTION_INFO("Disallowed pragma", "%s", A65_STRING_CHECK(pragma.to_string()));
+				break;
+			case A65_TOKEN_PRAGMA_ONCE:
+				break;
+			default:
+				A65_THROW_EXCEPTION_INFO("Malformed pragma tree", "%s", A65_STRING_CHECK(pragma.to_string()));
+		}
+	} else {
+
+		for(size_t child = 0; child < tree.node().child_count(); ++child) {
+			a65_tree::move_child(tree, child);
+			preprocess_include(parser, tree);
+			a65_tree::move_parent(tree);
+		}
+	}
+
+	A65_DEBUG_EXIT();
+}
+
 std::string
 a65_assembler::preprocess_pragma(
 	__in a65_parser &parser,
@@ -2208,27 +4113,24 @@ a65_assembler::preprocess_pragma(
 		case A65_TOKEN_PRAGMA_INCLUDE_BINARY:
 
 			try {
-				size_t size;
-				std::string data;
-
 				a65_tree::move_child(tree, 0);
 				entry = parser.token(tree.node().token());
-				path << m_input << A65_ASSEMBLER_OUTPUT_SEPERATOR << entry.literal();
+				path << a65_include::resolve(m_input, entry.literal(), m_include_path, m_build_missing);
 				a65_tree::move_parent(tree);
 
-				size = a65_utility::read_file(path.str(), data);
-				if(size) {
+				a65_buffer data(path.str(), true);
+				if(data.length()) {
 					result << A65_TOKEN_PRAGMA_STRING(A65_TOKEN_PRAGMA_METADATA)
 						<< " " << A65_CHARACTER_LITERAL << path.str() << A65_CHARACTER_LITERAL << " " << A65_CHARACTER_ZERO
 						<< std::endl << A65_TOKEN_DIRECTIVE_STRING(A65_TOKEN_DIRECTIVE_DATA_BYTE);
 
-					for(std::string::iterator ch = data.begin(); ch != data.end(); ++ch) {
+					for(size_t ch = 0; ch < data.length(); ++ch) {
 
-						if(ch != data.begin()) {
+						if(ch) {
 							result << ",";
 						}
 
-						result << " " << A65_CHARACTER_ZERO << A65_CHARACTER_DIGIT_HEXIDECIMAL << A65_STRING_HEX(uint8_t, *ch);
+						result << " " << A65_CHARACTER_ZERO << A65_CHARACTER_DIGIT_HEXIDECIMAL << A65_STRING_HEX(uint8_t, data.data()[ch]);
 					}
 
 					entry = parser.token(tree.node().token());
@@ -2243,12 +4145,15 @@ a65_assembler::preprocess_pragma(
 		case A65_TOKEN_PRAGMA_INCLUDE_SOURCE:
 			a65_tree::move_child(tree, 0);
 			entry = parser.token(tree.node().token());
-			path << m_input << A65_ASSEMBLER_OUTPUT_SEPERATOR << entry.literal();
+			path << a65_include::resolve(m_input, entry.literal(), m_include_path, m_build_missing);
 			a65_tree::move_parent(tree);
 
 			result << A65_TOKEN_PRAGMA_STRING(A65_TOKEN_PRAGMA_METADATA)
-				<< " " << A65_CHARACTER_LITERAL << path.str() << A65_CHARACTER_LITERAL << " " << A65_CHARACTER_ZERO
-				<< assembler.preprocess(path.str());
+				<< " " << A65_CHARACTER_LITERAL << path.str() << A65_CHARACTER_LITERAL << " " << A65_CHARACTER_ZERO;
+
+			assembler.m_include_path = m_include_path;
+			assembler.load_include(path.str());
+			result << assembler.preprocess();
 
 			entry = parser.token(tree.node().token());
 			result << std::endl << A65_TOKEN_PRAGMA_STRING(A65_TOKEN_PRAGMA_METADATA)
@@ -2258,6 +4163,9 @@ a65_assembler::preprocess_pragma(
 		case A65_TOKEN_PRAGMA_METADATA:
 			A65_THROW_EXCEPTION_INFO("Disallowed pragma", "%s", A65_STRING_CHECK(entry.to_string()));
 			break;
+		case A65_TOKEN_PRAGMA_ONCE:
+			result << A65_TOKEN_PRAGMA_STRING(A65_TOKEN_PRAGMA_ONCE);
+			break;
 		default:
 			A65_THROW_EXCEPTION_INFO("Malformed pragma tree", "%s", A65_STRING_CHECK(entry.to_string()));
 	}
@@ -2266,21 +4174,112 @@ a65_assembler::preprocess_pragma(
 	return result.str();
 }
 
+void
+a65_assembler::preprocess_tree(
+	__in_opt const std::string &input
+	)
+{
+	std::string name;
+
+	A65_DEBUG_ENTRY_INFO("Input[%u]=%p", input.size(), &input);
+
+	if(!input.empty()) {
+		m_input = a65_utility::decompose_file_path(input, name);
+		a65_parser::load(input);
+	} else {
+		a65_parser::reset();
+	}
+
+	m_include.clear();
+	m_include_alias.clear();
+	m_include_binary.clear();
+
+	while(a65_parser::has_next()) {
+		a65_tree &tree = a65_parser::tree_ref();
+
+		if(!tree.node().match(A65_NODE_BEGIN)
+				&& !tree.node().match(A65_NODE_END)) {
+			preprocess_include(*this, tree);
+		}
+
+		a65_parser::move_next();
+	}
+
+	a65_parser::reset();
+
+	A65_DEBUG_EXIT();
+}
+
+size_t
+a65_assembler::relaxed(void) const
+{
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT_INFO("Result=%u", m_relaxed);
+	return m_relaxed;
+}
+
 void
 a65_assembler::remove_define(
 	__in const a65_token &token
 	)
 {
-	std::map<std::string, uint16_t>::iterator entry;
-
 	A65_DEBUG_ENTRY_INFO("Token=%p", &token);
 
-	entry = m_define.find(token.literal());
-	if(entry == m_define.end()) {
+	if(!m_symbol.contains(A65_SYMBOL_DEFINE, token.symbol())) {
 		A65_THROW_EXCEPTION_INFO("Define not found", "%s", A65_STRING_CHECK(token.to_string()));
 	}
 
-	m_define.erase(entry);
+	m_symbol.remove(A65_SYMBOL_DEFINE, m_symbol.find(token.symbol()));
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_assembler::set_build_cache(
+	__in const std::string &path
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Path[%u]=%s", path.size(), A65_STRING_CHECK(path));
+
+	m_build_cache = path;
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_assembler::set_depend(
+	__in bool depend,
+	__in_opt const std::string &path
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Depend=%x, Path[%u]=%s", depend, path.size(), A65_STRING_CHECK(path));
+
+	m_depend = depend;
+	m_depend_path = path;
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_assembler::set_include_path(
+	__in const std::vector<std::string> &path
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Path[%u]=%p", path.size(), &path);
+
+	m_include_path = path;
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_assembler::set_relax(
+	__in bool relax
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Relax=%x", relax);
+
+	m_relax = relax;
 
 	A65_DEBUG_EXIT();
 }
@@ -0,0 +1,189 @@
+/**
+ * A65
+ * Copyright (C) 2018 David Jolly
+ *
+ * A65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/a65_buffer.h"
+#include "../inc/a65_utility.h"
+#ifdef A65_BUFFER_MAP_SUPPORTED
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // A65_BUFFER_MAP_SUPPORTED
+
+a65_buffer::a65_buffer(
+	__in_opt const std::string &input,
+	__in_opt bool is_path
+	) :
+		m_length(0),
+		m_map(nullptr),
+		m_map_length(0)
+{
+	A65_DEBUG_ENTRY_INFO("Input[%u]=%p (%s)", input.size(), &input, is_path ? "Path" : "Raw");
+
+	if(!is_path) {
+		m_character = input;
+	} else if(!input.empty() && !load_mapped(input)) {
+		load_stream(input);
+	}
+
+	if(!m_map) {
+		m_length = m_character.size();
+		m_character.push_back(A65_BUFFER_SENTINEL);
+	}
+
+	A65_DEBUG_EXIT();
+}
+
+a65_buffer::~a65_buffer(void)
+{
+	A65_DEBUG_ENTRY();
+
+#ifdef A65_BUFFER_MAP_SUPPORTED
+	if(m_map) {
+		munmap(m_map, m_map_length);
+	}
+#endif // A65_BUFFER_MAP_SUPPORTED
+
+	A65_DEBUG_EXIT();
+}
+
+const char *
+a65_buffer::data(void) const
+{
+	const char *result;
+
+	A65_DEBUG_ENTRY();
+
+	result = (m_map ? (const char *) m_map : m_character.data());
+
+	A65_DEBUG_EXIT_INFO("Result=%p", result);
+	return result;
+}
+
+size_t
+a65_buffer::length(void) const
+{
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT_INFO("Result=%u", m_length);
+	return m_length;
+}
+
+bool
+a65_buffer::load_mapped(
+	__in const std::string &path
+	)
+{
+	bool result = false;
+
+	A65_DEBUG_ENTRY_INFO("Path[%u]=%s", path.size(), A65_STRING_CHECK(path));
+
+#ifdef A65_BUFFER_MAP_SUPPORTED
+	struct stat status;
+
+	if(!stat(path.c_str(), &status) && S_ISREG(status.st_mode) && (status.st_size >= A65_BUFFER_MAP_LENGTH_MIN)) {
+		int file;
+
+		file = open(path.c_str(), O_RDONLY);
+		if(file >= 0) {
+			size_t length, page;
+			void *map, *reserve;
+
+			page = sysconf(_SC_PAGESIZE);
+			length = (((status.st_size + 1 + page - 1) / page) * page);
+
+			reserve = mmap(nullptr, length, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if(reserve != MAP_FAILED) {
+
+				map = mmap(reserve, status.st_size, PROT_READ, MAP_PRIVATE | MAP_FIXED, file, 0);
+				if(map != MAP_FAILED) {
+					m_length = status.st_size;
+					m_map = map;
+					m_map_length = length;
+					result = true;
+				} else {
+					munmap(reserve, length);
+				}
+			}
+
+			close(file);
+		}
+	}
+#endif // A65_BUFFER_MAP_SUPPORTED
+
+	A65_DEBUG_EXIT_INFO("Result=%x", result);
+	return result;
+}
+
+void
+a65_buffer::load_stream(
+	__in const std::string &path
+	)
+{
+	std::ifstream file;
+
+	A65_DEBUG_ENTRY_INFO("Path[%u]=%s", path.size(), A65_STRING_CHECK(path));
+
+	file = std::ifstream(path.c_str(), std::ios::binary | std::ios::in);
+	if(!file) {
+		A65_THROW_EXCEPTION_INFO("File not found", "[%u]%s", path.size(), A65_STRING_CHECK(path));
+	}
+
+	m_character.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	file.close();
+
+	A65_DEBUG_EXIT();
+}
+
+bool
+a65_buffer::mapped(void) const
+{
+	bool result;
+
+	A65_DEBUG_ENTRY();
+
+	result = (m_map != nullptr);
+
+	A65_DEBUG_EXIT_INFO("Result=%x", result);
+	return result;
+}
+
+size_t
+a65_buffer::size(void) const
+{
+	size_t result;
+
+	A65_DEBUG_ENTRY();
+
+	result = (m_length + 1);
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+std::string
+a65_buffer::to_string(void) const
+{
+	std::stringstream result;
+
+	A65_DEBUG_ENTRY();
+
+	result << "[" << m_length << "] {" << (m_map ? "Mapped" : "Heap") << "} " << (void *) data();
+
+	A65_DEBUG_EXIT();
+	return result.str();
+}
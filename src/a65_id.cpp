@@ -20,7 +20,8 @@
 #include "../inc/a65_utility.h"
 
 a65_id::a65_id(void) :
-	m_id(A65_UUID_INVALID)
+	m_id(A65_UUID_INVALID),
+	m_uuid(nullptr)
 {
 	A65_DEBUG_ENTRY();
 
@@ -32,7 +33,8 @@ a65_id::a65_id(void) :
 a65_id::a65_id(
 	__in const a65_id &other
 	) :
-		m_id(other.m_id)
+		m_id(other.m_id),
+		m_uuid(other.m_uuid)
 {
 	A65_DEBUG_ENTRY();
 
@@ -60,6 +62,7 @@ a65_id::operator=(
 	if(this != &other) {
 		decrement();
 		m_id = other.m_id;
+		m_uuid = other.m_uuid;
 		increment();
 	}
 
@@ -72,9 +75,8 @@ a65_id::decrement(void)
 {
 	A65_DEBUG_ENTRY();
 
-	a65_uuid &instance = a65_uuid::instance();
-	if(instance.contains(m_id)) {
-		instance.decrement(m_id);
+	if(m_uuid && (m_id != A65_UUID_INVALID) && m_uuid->contains(m_id)) {
+		m_uuid->decrement(m_id);
 	}
 
 	m_id = A65_UUID_INVALID;
@@ -87,7 +89,8 @@ a65_id::generate(void)
 {
 	A65_DEBUG_ENTRY();
 
-	m_id = a65_uuid::instance().generate();
+	m_uuid = &a65_uuid::instance();
+	m_id = m_uuid->generate();
 
 	A65_DEBUG_EXIT();
 }
@@ -105,9 +108,8 @@ a65_id::increment(void)
 {
 	A65_DEBUG_ENTRY();
 
-	a65_uuid &instance = a65_uuid::instance();
-	if(instance.contains(m_id)) {
-		instance.increment(m_id);
+	if(m_uuid && (m_id != A65_UUID_INVALID) && m_uuid->contains(m_id)) {
+		m_uuid->increment(m_id);
 	}
 
 	A65_DEBUG_EXIT();
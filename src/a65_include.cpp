@@ -0,0 +1,116 @@
+/**
+ * A65
+ * Copyright (C) 2018 David Jolly
+ *
+ * A65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../inc/a65_include.h"
+#include "../inc/a65_utility.h"
+
+static thread_local std::map<std::string, std::pair<bool, a65_snapshot_identity_t>> g_identity;
+
+static thread_local std::map<std::string, std::pair<std::string, std::vector<std::string>>> g_resolve;
+
+void
+a65_include::clear(void)
+{
+	A65_DEBUG_ENTRY();
+
+	g_identity.clear();
+	g_resolve.clear();
+
+	A65_DEBUG_EXIT();
+}
+
+bool
+a65_include::identify(
+	__in const std::string &path,
+	__inout a65_snapshot_identity_t &identity
+	)
+{
+	bool result = false;
+	std::map<std::string, std::pair<bool, a65_snapshot_identity_t>>::iterator entry;
+
+	A65_DEBUG_ENTRY_INFO("Path[%u]=%s, Identity=%p", path.size(), A65_STRING_CHECK(path), &identity);
+
+	entry = g_identity.find(path);
+	if(entry == g_identity.end()) {
+		a65_snapshot_identity_t status = {};
+
+		result = a65_snapshot::identify(path, status);
+		entry = g_identity.insert(std::make_pair(path, std::make_pair(result, status))).first;
+	}
+
+	result = entry->second.first;
+	identity = entry->second.second;
+
+	A65_DEBUG_EXIT_INFO("Result=%x", result);
+	return result;
+}
+
+std::string
+a65_include::resolve(
+	__in const std::string &directory,
+	__in const std::string &name,
+	__in const std::vector<std::string> &search,
+	__inout std::set<std::string> &missing
+	)
+{
+	std::stringstream key;
+	std::string result;
+	std::vector<std::string> candidate;
+	std::map<std::string, std::pair<std::string, std::vector<std::string>>>::iterator entry;
+
+	A65_DEBUG_ENTRY_INFO("Directory[%u]=%s, Name[%u]=%s, Search[%u]=%p, Missing[%u]=%p", directory.size(),
+		A65_STRING_CHECK(directory), name.size(), A65_STRING_CHECK(name), search.size(), &search, missing.size(), &missing);
+
+	key << directory << '\n' << name;
+
+	for(std::vector<std::string>::const_iterator path = search.begin(); path != search.end(); ++path) {
+		key << '\n' << *path;
+	}
+
+	entry = g_resolve.find(key.str());
+	if(entry == g_resolve.end()) {
+
+		if(!name.compare(0, std::string(A65_INCLUDE_SEPERATOR).size(), A65_INCLUDE_SEPERATOR)) {
+			candidate.push_back(name);
+		} else {
+			candidate.push_back(directory + A65_INCLUDE_SEPERATOR + name);
+
+			for(std::vector<std::string>::const_iterator path = search.begin(); path != search.end(); ++path) {
+				candidate.push_back(*path + A65_INCLUDE_SEPERATOR + name);
+			}
+		}
+
+		entry = g_resolve.insert(std::make_pair(key.str(), std::make_pair(candidate.front(), std::vector<std::string>()))).first;
+
+		for(std::vector<std::string>::iterator path = candidate.begin(); path != candidate.end(); ++path) {
+			a65_snapshot_identity_t identity = {};
+
+			if(identify(*path, identity)) {
+				entry->second.first = *path;
+				break;
+			}
+
+			entry->second.second.push_back(*path);
+		}
+	}
+
+	result = entry->second.first;
+	missing.insert(entry->second.second.begin(), entry->second.second.end());
+
+	A65_DEBUG_EXIT_INFO("Result[%u]=%s", result.size(), A65_STRING_CHECK(result));
+	return result;
+}
@@ -0,0 +1,159 @@
+/**
+ * A65
+ * Copyright (C) 2018 David Jolly
+ *
+ * A65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/a65_intern.h"
+#include "../inc/a65_utility.h"
+
+static thread_local a65_intern *g_context = nullptr;
+
+a65_intern::a65_intern(void) :
+	m_next(A65_INTERN_INVALID + 1)
+{
+	A65_DEBUG_ENTRY();
+
+	for(size_t index = 0; index < A65_INTERN_PAGE_COUNT; ++index) {
+		m_page[index].store(nullptr, std::memory_order_relaxed);
+	}
+
+	A65_DEBUG_EXIT();
+}
+
+a65_intern::~a65_intern(void)
+{
+	A65_DEBUG_ENTRY();
+
+	for(size_t index = 0; index < A65_INTERN_PAGE_COUNT; ++index) {
+		a65_intern_page_t *entry = m_page[index].exchange(nullptr);
+
+		if(entry) {
+			delete entry;
+		}
+	}
+
+	A65_DEBUG_EXIT();
+}
+
+a65_intern *
+a65_intern::bind(
+	__in_opt a65_intern *context
+	)
+{
+	a65_intern *result;
+
+	A65_DEBUG_ENTRY_INFO("Context=%p", context);
+
+	result = g_context;
+	g_context = context;
+
+	A65_DEBUG_EXIT_INFO("Result=%p", result);
+	return result;
+}
+
+size_t
+a65_intern::count(void) const
+{
+	size_t result;
+
+	A65_DEBUG_ENTRY();
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	result = m_entry.size();
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+const std::string &
+a65_intern::find(
+	__in uint32_t id
+	) const
+{
+	a65_intern_page_t *entry = nullptr;
+	static const std::string empty;
+	const std::string *result = &empty;
+
+	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
+
+	if(id != A65_INTERN_INVALID) {
+
+		if(id <= A65_INTERN_MAX) {
+			entry = m_page[A65_INTERN_PAGE(id)].load(std::memory_order_acquire);
+		}
+
+		if(!entry || !entry->entry[A65_INTERN_PAGE_OFFSET(id)]) {
+			A65_THROW_EXCEPTION_INFO("Interned string not found", "%u(%x)", id, id);
+		}
+
+		result = entry->entry[A65_INTERN_PAGE_OFFSET(id)];
+	}
+
+	A65_DEBUG_EXIT_INFO("Result[%u]=%s", result->size(), A65_STRING_CHECK(*result));
+	return *result;
+}
+
+uint32_t
+a65_intern::generate(
+	__in const std::string &value
+	)
+{
+	uint32_t result = A65_INTERN_INVALID;
+
+	A65_DEBUG_ENTRY_INFO("Value[%u]=%s", value.size(), A65_STRING_CHECK(value));
+
+	if(!value.empty()) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		std::unordered_map<std::string, uint32_t>::iterator entry = m_entry.find(value);
+
+		if(entry == m_entry.end()) {
+			a65_intern_page_t *page;
+
+			if(m_next > A65_INTERN_MAX) {
+				A65_THROW_EXCEPTION_INFO("No avaliable interned string", "%s", A65_STRING_CHECK(value));
+			}
+
+			result = m_next++;
+			entry = m_entry.insert(std::make_pair(value, result)).first;
+
+			page = m_page[A65_INTERN_PAGE(result)].load(std::memory_order_relaxed);
+			if(!page) {
+				page = new a65_intern_page_t();
+				m_page[A65_INTERN_PAGE(result)].store(page, std::memory_order_release);
+			}
+
+			page->entry[A65_INTERN_PAGE_OFFSET(result)] = &entry->first;
+		} else {
+			result = entry->second;
+		}
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u(%x)", result, result);
+	return result;
+}
+
+a65_intern &
+a65_intern::instance(void)
+{
+	A65_DEBUG_ENTRY();
+
+	static a65_intern result;
+
+	a65_intern &context = (g_context ? *g_context : result);
+
+	A65_DEBUG_EXIT_INFO("Result=%p", &context);
+	return context;
+}
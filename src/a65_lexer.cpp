@@ -24,6 +24,7 @@ a65_lexer::a65_lexer(
 	__in_opt bool is_path
 	) :
 		a65_stream(input, is_path),
+		m_file(A65_INTERN_INVALID),
 		m_token_position(0)
 {
 	A65_DEBUG_ENTRY_INFO("Input[%u]=%p (%s)", input.size(), &input, is_path ? "File" : "Raw");
@@ -37,6 +38,7 @@ a65_lexer::a65_lexer(
 	__in const a65_lexer &other
 	) :
 		a65_stream(other),
+		m_file(other.m_file),
 		m_token(other.m_token),
 		m_token_map(other.m_token_map),
 		m_token_position(other.m_token_position)
@@ -60,6 +62,7 @@ a65_lexer::operator=(
 
 	if(this != &other) {
 		a65_stream::operator=(other);
+		m_file = other.m_file;
 		m_token = other.m_token;
 		m_token_map = other.m_token_map;
 		m_token_position = other.m_token_position;
@@ -114,6 +117,7 @@ a65_lexer::clear(void)
 	A65_DEBUG_ENTRY();
 
 	a65_stream::reset();
+	m_file = a65_intern::instance().generate(path());
 	m_token.clear();
 	m_token_map.clear();
 	m_token_position = 0;
@@ -147,7 +151,7 @@ a65_lexer::enumerate(void)
 
 	A65_DEBUG_ENTRY();
 
-	result.set_metadata(path(), line());
+	result.set_location(m_file, line(), column());
 
 	type = character_type();
 	switch(type) {
@@ -185,38 +189,27 @@ a65_lexer::enumerate_alpha(
 	} else if(a65_stream::match(A65_STREAM_CHARACTER_SYMBOL, A65_CHARACTER_PRAGMA)) {
 		enumerate_alpha_pragma(token);
 	} else {
-		std::string literal;
+		int subtype, type;
+		std::string_view literal;
 
-		literal += character();
+		literal = enumerate_alpha_identifier();
 
-		if(a65_stream::has_next()) {
-			a65_stream::move_next();
-
-			while(a65_stream::match(A65_STREAM_CHARACTER_ALPHA)
-					|| a65_stream::match(A65_STREAM_CHARACTER_DIGIT)
-					|| a65_stream::match(A65_STREAM_CHARACTER_SYMBOL, A65_CHARACTER_UNDERSCORE)) {
-				literal += character();
-				a65_stream::move_next();
-			}
+		if(find_keyword(literal, type, subtype) && ((type == A65_TOKEN_COMMAND) || (type == A65_TOKEN_CONSTANT)
+				|| (type == A65_TOKEN_MACRO) || (type == A65_TOKEN_REGISTER))) {
+			token.set(type, subtype);
+		} else {
+			std::string value(literal);
 
-			A65_STRING_LOWER(literal);
+			A65_STRING_LOWER(value);
 
-			if(A65_IS_TOKEN_COMMAND(literal)) {
-				token.set(A65_TOKEN_COMMAND, A65_TOKEN_COMMAND_ID(literal));
-			} else if(A65_IS_TOKEN_CONSTANT(literal)) {
-				token.set(A65_TOKEN_CONSTANT, A65_TOKEN_CONSTANT_ID(literal));
-			} else if(A65_IS_TOKEN_MACRO(literal)) {
-				token.set(A65_TOKEN_MACRO, A65_TOKEN_MACRO_ID(literal));
-			} else if(A65_IS_TOKEN_REGISTER(literal)) {
-				token.set(A65_TOKEN_REGISTER, A65_TOKEN_REGISTER_ID(literal));
-			} else if(a65_stream::match(A65_STREAM_CHARACTER_SYMBOL, A65_CHARACTER_LABEL)) {
+			if(a65_stream::match(A65_STREAM_CHARACTER_SYMBOL, A65_CHARACTER_LABEL)) {
 				a65_stream::move_next();
 				token.set(A65_TOKEN_LABEL);
-				token.set_literal(literal);
 			} else {
 				token.set(A65_TOKEN_IDENTIFIER);
-				token.set_literal(literal);
 			}
+
+			token.set_literal(value);
 		}
 	}
 
@@ -333,45 +326,50 @@ a65_lexer::enumerate_alpha_directive(
 	__inout a65_token &token
 	)
 {
-	std::string literal;
+	int subtype, type;
+	std::string_view literal;
 
 	A65_DEBUG_ENTRY_INFO("Token=%s", A65_STRING_CHECK(token.to_string()));
 
-	literal += character();
-
-	if(!a65_stream::has_next()) {
-		A65_THROW_EXCEPTION_INFO("Unterminated directive", "%s (%s:%u)", A65_STRING_CHECK(literal), A65_STRING_CHECK(path()), line());
+	literal = enumerate_alpha_identifier();
+	if(literal.size() <= 1) {
+		A65_THROW_EXCEPTION_INFO("Unterminated directive", "%s (%s:%u)", A65_STRING_CHECK(std::string(literal)), A65_STRING_CHECK(path()),
+			line());
 	}
 
-	a65_stream::move_next();
+	if(!find_keyword(literal, type, subtype) || (type != A65_TOKEN_DIRECTIVE)) {
+		std::string value(literal);
 
-	if(!a65_stream::match(A65_STREAM_CHARACTER_ALPHA)
-			&& !a65_stream::match(A65_STREAM_CHARACTER_DIGIT)
-			&& !a65_stream::match(A65_STREAM_CHARACTER_SYMBOL, A65_CHARACTER_UNDERSCORE)) {
-		A65_THROW_EXCEPTION_INFO("Unterminated directive", "%s (%s:%u)", A65_STRING_CHECK(literal), A65_STRING_CHECK(path()), line());
+		A65_STRING_LOWER(value);
+		A65_THROW_EXCEPTION_INFO("Unsupported directive", "%s (%s:%u)", A65_STRING_CHECK(value), A65_STRING_CHECK(path()), line());
 	}
 
-	while(a65_stream::match(A65_STREAM_CHARACTER_ALPHA)
-			|| a65_stream::match(A65_STREAM_CHARACTER_DIGIT)
-			|| a65_stream::match(A65_STREAM_CHARACTER_SYMBOL, A65_CHARACTER_UNDERSCORE)) {
-		literal += character();
+	token.set(type, subtype);
 
-		if(!a65_stream::has_next()) {
-			break;
-		}
+	A65_DEBUG_ENTRY_INFO("Result=%s", A65_STRING_CHECK(token.to_string()));
+}
 
-		a65_stream::move_next();
-	}
+std::string_view
+a65_lexer::enumerate_alpha_identifier(void)
+{
+	size_t position;
+	std::string_view result;
 
-	A65_STRING_LOWER(literal);
+	A65_DEBUG_ENTRY();
+
+	position = m_character_position;
 
-	if(!A65_IS_TOKEN_DIRECTIVE(literal)) {
-		A65_THROW_EXCEPTION_INFO("Unsupported directive", "%s (%s:%u)", A65_STRING_CHECK(literal), A65_STRING_CHECK(path()), line());
+	if(a65_stream::has_next()) {
+
+		do {
+			++m_character_position;
+		} while(A65_IS_STREAM_CHARACTER_FLAG(m_character[m_character_position], A65_STREAM_CHARACTER_FLAG_IDENTIFIER));
 	}
 
-	token.set(A65_TOKEN_DIRECTIVE, A65_TOKEN_DIRECTIVE_ID(literal));
+	result = std::string_view(m_character).substr(position, m_character_position - position);
 
-	A65_DEBUG_ENTRY_INFO("Result=%s", A65_STRING_CHECK(token.to_string()));
+	A65_DEBUG_EXIT_INFO("Result[%u]=%p", result.size(), result.data());
+	return result;
 }
 
 void
@@ -459,43 +457,25 @@ a65_lexer::enumerate_alpha_pragma(
 	__inout a65_token &token
 	)
 {
-	std::string literal;
+	int subtype, type;
+	std::string_view literal;
 
 	A65_DEBUG_ENTRY_INFO("Token=%s", A65_STRING_CHECK(token.to_string()));
 
-	literal += character();
-
-	if(!a65_stream::has_next()) {
-		A65_THROW_EXCEPTION_INFO("Unterminated pragma", "%s (%s:%u)", A65_STRING_CHECK(literal), A65_STRING_CHECK(path()), line());
+	literal = enumerate_alpha_identifier();
+	if(literal.size() <= 1) {
+		A65_THROW_EXCEPTION_INFO("Unterminated pragma", "%s (%s:%u)", A65_STRING_CHECK(std::string(literal)), A65_STRING_CHECK(path()),
+			line());
 	}
 
-	a65_stream::move_next();
+	if(!find_keyword(literal, type, subtype) || (type != A65_TOKEN_PRAGMA)) {
+		std::string value(literal);
 
-	if(!a65_stream::match(A65_STREAM_CHARACTER_ALPHA)
-			&& !a65_stream::match(A65_STREAM_CHARACTER_DIGIT)
-			&& !a65_stream::match(A65_STREAM_CHARACTER_SYMBOL, A65_CHARACTER_UNDERSCORE)) {
-		A65_THROW_EXCEPTION_INFO("Unterminated pragma", "%s (%s:%u)", A65_STRING_CHECK(literal), A65_STRING_CHECK(path()), line());
+		A65_STRING_LOWER(value);
+		A65_THROW_EXCEPTION_INFO("Unsupported pragma", "%s (%s:%u)", A65_STRING_CHECK(value), A65_STRING_CHECK(path()), line());
 	}
 
-	while(a65_stream::match(A65_STREAM_CHARACTER_ALPHA)
-			|| a65_stream::match(A65_STREAM_CHARACTER_DIGIT)
-			|| a65_stream::match(A65_STREAM_CHARACTER_SYMBOL, A65_CHARACTER_UNDERSCORE)) {
-		literal += character();
-
-		if(!a65_stream::has_next()) {
-			break;
-		}
-
-		a65_stream::move_next();
-	}
-
-	A65_STRING_LOWER(literal);
-
-	if(!A65_IS_TOKEN_PRAGMA(literal)) {
-		A65_THROW_EXCEPTION_INFO("Unsupported pragma", "%s (%s:%u)", A65_STRING_CHECK(literal), A65_STRING_CHECK(path()), line());
-	}
-
-	token.set(A65_TOKEN_PRAGMA, A65_TOKEN_PRAGMA_ID(literal));
+	token.set(type, subtype);
 
 	A65_DEBUG_ENTRY_INFO("Result=%s", A65_STRING_CHECK(token.to_string()));
 }
@@ -716,9 +696,10 @@ a65_lexer::enumerate_symbol(
 		enumerate_alpha(token);
 	} else {
 		bool negate;
-		std::string literal;
+		size_t position;
+		int subtype, type;
 
-		literal += character();
+		position = m_character_position;
 		negate = a65_stream::match(A65_STREAM_CHARACTER_SYMBOL, A65_CHARACTER_NEGATION);
 
 		if(a65_stream::has_next()) {
@@ -728,22 +709,17 @@ a65_lexer::enumerate_symbol(
 				enumerate_digit(token, negate);
 			} else {
 
-				if(a65_stream::match(A65_STREAM_CHARACTER_SYMBOL)) {
-
-					literal += character();
-					if(!A65_IS_TOKEN_SYMBOL(literal)) {
-						literal.erase(literal.end() - 1);
-					} else {
-						a65_stream::move_next();
-					}
-				}
-
-				if(!A65_IS_TOKEN_SYMBOL(literal)) {
-					A65_THROW_EXCEPTION_INFO("Unsupported symbol", "%s (%s:%u)", A65_STRING_CHECK(literal),
+				if(a65_stream::match(A65_STREAM_CHARACTER_SYMBOL)
+						&& find_keyword(std::string_view(m_character).substr(position, 2), type, subtype)
+						&& (type == A65_TOKEN_SYMBOL)) {
+					a65_stream::move_next();
+				} else if(!find_keyword(std::string_view(m_character).substr(position, 1), type, subtype)
+						|| (type != A65_TOKEN_SYMBOL)) {
+					A65_THROW_EXCEPTION_INFO("Unsupported symbol", "%s (%s:%u)", A65_STRING_CHECK(std::string(m_character.substr(position, 1))),
 						A65_STRING_CHECK(path()), line());
 				}
 
-				token.set(A65_TOKEN_SYMBOL, A65_TOKEN_SYMBOL_ID(literal));
+				token.set(A65_TOKEN_SYMBOL, subtype);
 			}
 		}
 	}
@@ -751,6 +727,28 @@ a65_lexer::enumerate_symbol(
 	A65_DEBUG_ENTRY_INFO("Result=%s", A65_STRING_CHECK(token.to_string()));
 }
 
+void
+a65_lexer::export_snapshot(
+	__inout a65_snapshot &snapshot,
+	__inout std::map<uint32_t, uint32_t> &index
+	) const
+{
+	std::vector<uint32_t>::const_iterator entry;
+	std::map<uint32_t, a65_token>::const_iterator token;
+
+	A65_DEBUG_ENTRY_INFO("Snapshot=%p, Index=%p", &snapshot, &index);
+
+	for(token = m_token_map.begin(); token != m_token_map.end(); ++token) {
+		index.insert(std::make_pair(token->first, snapshot.add_token(token->second)));
+	}
+
+	for(entry = m_token.begin(); entry != m_token.end(); ++entry) {
+		snapshot.add_token_sequence(index.at(*entry));
+	}
+
+	A65_DEBUG_EXIT();
+}
+
 std::map<uint32_t, a65_token>::iterator
 a65_lexer::find(
 	__in uint32_t id
@@ -769,6 +767,39 @@ a65_lexer::find(
 	return result;
 }
 
+bool
+a65_lexer::find_keyword(
+	__in const std::string_view &literal,
+	__inout int &type,
+	__inout int &subtype
+	)
+{
+	uint64_t key;
+	bool result = false;
+
+	A65_DEBUG_ENTRY_INFO("Literal[%u]=%p", literal.size(), literal.data());
+
+	key = keyword_key(literal);
+	if(key) {
+		uint8_t index;
+		const a65_lexer_keyword_table_t &table = keyword_table();
+
+		index = table.slot[A65_LEXER_KEYWORD_HASH(key, table.seed)];
+		if(index) {
+			const a65_lexer_keyword_t &entry = table.keyword.at(index - 1);
+
+			result = (entry.key == key);
+			if(result) {
+				type = entry.type;
+				subtype = entry.subtype;
+			}
+		}
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%x", result);
+	return result;
+}
+
 bool
 a65_lexer::has_next(void) const
 {
@@ -776,7 +807,7 @@ a65_lexer::has_next(void) const
 
 	A65_DEBUG_ENTRY();
 
-	result = !token().match(A65_TOKEN_END);
+	result = !token_ref().match(A65_TOKEN_END);
 
 	A65_DEBUG_EXIT_INFO("Result=%x", result);
 	return result;
@@ -795,6 +826,168 @@ a65_lexer::has_previous(void) const
 	return result;
 }
 
+void
+a65_lexer::import_snapshot(
+	__in const a65_snapshot &snapshot,
+	__in const std::string &path,
+	__inout std::vector<uint32_t> &id
+	)
+{
+	size_t position;
+
+	A65_DEBUG_ENTRY_INFO("Snapshot=%p, Path[%u]=%s, Id=%p", &snapshot, path.size(), A65_STRING_CHECK(path), &id);
+
+	a65_stream::set_metadata(path);
+	m_file = a65_intern::instance().generate(path);
+	m_token.clear();
+	m_token_map.clear();
+	id.clear();
+
+	for(position = 0; position < snapshot.token_count(); ++position) {
+		const a65_snapshot_token_t &entry = snapshot.token(position);
+		a65_token token(entry.type, entry.subtype, entry.mode);
+
+		token.set_location((entry.file != A65_SNAPSHOT_INVALID) ? m_file : A65_INTERN_INVALID, entry.line, entry.column);
+		token.set_literal(snapshot.string(entry.literal));
+		token.set_scalar(entry.scalar);
+		id.push_back(token.id());
+		m_token_map.insert(std::make_pair(token.id(), token));
+	}
+
+	for(position = 0; position < snapshot.sequence_count(); ++position) {
+		m_token.push_back(id.at(snapshot.sequence(position)));
+	}
+
+	m_token_position = (m_token.empty() ? 0 : (m_token.size() - 1));
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_lexer::insert_keyword(
+	__inout a65_lexer_keyword_table_t &table,
+	__in const std::string &literal,
+	__in int type,
+	__in int subtype
+	)
+{
+	a65_lexer_keyword_t entry = {};
+
+	A65_DEBUG_ENTRY_INFO("Table=%p, Literal[%u]=%s, Type=%i(%s), Subtype=%i", &table, literal.size(), A65_STRING_CHECK(literal),
+		type, A65_TOKEN_STRING(type), subtype);
+
+	entry.key = keyword_key(literal);
+	if(!entry.key) {
+		A65_THROW_EXCEPTION_INFO("Keyword too long", "%s", A65_STRING_CHECK(literal));
+	}
+
+	entry.type = type;
+	entry.subtype = subtype;
+	table.keyword.push_back(entry);
+
+	A65_DEBUG_EXIT();
+}
+
+uint64_t
+a65_lexer::keyword_key(
+	__in const std::string_view &literal
+	)
+{
+	uint64_t result = 0;
+
+	A65_DEBUG_ENTRY_INFO("Literal[%u]=%p", literal.size(), literal.data());
+
+	if(!literal.empty() && (literal.size() <= A65_LEXER_KEYWORD_LENGTH_MAX)) {
+
+		for(std::string_view::const_iterator ch = literal.begin(); ch != literal.end(); ++ch) {
+			result = ((result << 8) | (uint8_t) std::tolower(*ch));
+		}
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%llx", result);
+	return result;
+}
+
+const a65_lexer_keyword_table_t &
+a65_lexer::keyword_table(void)
+{
+	static const a65_lexer_keyword_table_t result = keyword_table_build();
+
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT_INFO("Result=%p", &result);
+	return result;
+}
+
+a65_lexer_keyword_table_t
+a65_lexer::keyword_table_build(void)
+{
+	int type;
+	size_t attempt;
+	a65_lexer_keyword_table_t result = {};
+
+	A65_DEBUG_ENTRY();
+
+	for(type = 0; type <= A65_TOKEN_COMMAND_MAX; ++type) {
+		insert_keyword(result, A65_TOKEN_COMMAND_STR[type], A65_TOKEN_COMMAND, type);
+	}
+
+	for(type = 0; type <= A65_TOKEN_CONSTANT_MAX; ++type) {
+		insert_keyword(result, A65_TOKEN_CONSTANT_STR[type], A65_TOKEN_CONSTANT, type);
+	}
+
+	for(type = 0; type <= A65_TOKEN_DIRECTIVE_MAX; ++type) {
+		insert_keyword(result, A65_TOKEN_DIRECTIVE_STR[type], A65_TOKEN_DIRECTIVE, type);
+	}
+
+	for(type = 0; type <= A65_TOKEN_MACRO_MAX; ++type) {
+		insert_keyword(result, A65_TOKEN_MACRO_STR[type], A65_TOKEN_MACRO, type);
+	}
+
+	for(type = 0; type <= A65_TOKEN_PRAGMA_MAX; ++type) {
+		insert_keyword(result, A65_TOKEN_PRAGMA_STR[type], A65_TOKEN_PRAGMA, type);
+	}
+
+	for(type = 0; type <= A65_TOKEN_REGISTER_MAX; ++type) {
+		insert_keyword(result, A65_TOKEN_REGISTER_STR[type], A65_TOKEN_REGISTER, type);
+	}
+
+	for(type = 0; type <= A65_TOKEN_SYMBOL_MAX; ++type) {
+		insert_keyword(result, A65_TOKEN_SYMBOL_STR[type], A65_TOKEN_SYMBOL, type);
+	}
+
+	if(result.keyword.size() > UINT8_MAX) {
+		A65_THROW_EXCEPTION_INFO("Keyword table overflow", "%u (max=%u)", result.keyword.size(), UINT8_MAX);
+	}
+
+	for(attempt = 0, result.seed = A65_LEXER_KEYWORD_SEED; attempt < A65_LEXER_KEYWORD_SEED_ATTEMPT;
+			++attempt, result.seed += (A65_LEXER_KEYWORD_SEED << 1)) {
+		size_t index;
+
+		std::memset(result.slot, 0, sizeof(result.slot));
+
+		for(index = 0; index < result.keyword.size(); ++index) {
+			uint8_t &slot = result.slot[A65_LEXER_KEYWORD_HASH(result.keyword.at(index).key, result.seed)];
+
+			if(slot) {
+				break;
+			}
+
+			slot = (index + 1);
+		}
+
+		if(index == result.keyword.size()) {
+			break;
+		}
+	}
+
+	if(attempt == A65_LEXER_KEYWORD_SEED_ATTEMPT) {
+		A65_THROW_EXCEPTION_INFO("Keyword table seed not found", "%u attempts", attempt);
+	}
+
+	A65_DEBUG_EXIT_INFO("Result[%u]={Seed=%llx}", result.keyword.size(), result.seed);
+	return result;
+}
+
 void
 a65_lexer::load(
 	__in const std::string &input,
@@ -862,6 +1055,7 @@ a65_lexer::set_metadata(
 	A65_DEBUG_ENTRY_INFO("Path[%u]=%s", path.size(), A65_STRING_CHECK(path));
 
 	a65_stream::set_metadata(path);
+	m_file = a65_intern::instance().generate(path);
 
 	if(m_token.size() > m_token_position) {
 		std::map<uint32_t, a65_token>::iterator entry;
@@ -884,6 +1078,7 @@ a65_lexer::set_metadata(
 	A65_DEBUG_ENTRY_INFO("Path[%u]=%s", path.size(), A65_STRING_CHECK(path));
 
 	a65_stream::set_metadata(path, line);
+	m_file = a65_intern::instance().generate(path);
 
 	if(m_token.size() > m_token_position) {
 		std::map<uint32_t, a65_token>::iterator entry;
@@ -928,27 +1123,11 @@ a65_lexer::skip(void)
 {
 	A65_DEBUG_ENTRY();
 
-	while(a65_stream::match(A65_STREAM_CHARACTER_SPACE)) {
-
-		if(!a65_stream::has_next()) {
-			break;
-		}
+	a65_stream::skip_space();
 
-		a65_stream::move_next();
-	}
-
-	if(a65_stream::match(A65_STREAM_CHARACTER_SYMBOL, A65_CHARACTER_COMMENT)) {
-
-		while(!a65_stream::match(A65_STREAM_CHARACTER_SPACE, A65_CHARACTER_NEWLINE)) {
-
-			if(!a65_stream::has_next()) {
-				break;
-			}
-
-			a65_stream::move_next();
-		}
-
-		skip();
+	while(character() == A65_CHARACTER_COMMENT) {
+		a65_stream::skip_line();
+		a65_stream::skip_space();
 	}
 
 	A65_DEBUG_EXIT();
@@ -973,25 +1152,10 @@ a65_lexer::token(
 	) const
 {
 	a65_token result;
-	std::map<uint32_t, a65_token>::const_iterator entry;
 
 	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
 
-	if(id == A65_UUID_INVALID) {
-
-		if(m_token_position >= m_token.size()) {
-			A65_THROW_EXCEPTION_INFO("Token position out-of-range", "%u (max=%u)", m_token_position, m_token.size());
-		}
-
-		id = m_token.at(m_token_position);
-	}
-
-	entry = m_token_map.find(id);
-	if(entry == m_token_map.end()) {
-		A65_THROW_EXCEPTION_INFO("Token not found", "%u(%x)", id, id);
-	}
-
-	result = entry->second;
+	result = token_ref(id);
 
 	A65_DEBUG_EXIT_INFO("Result=%s", A65_STRING_CHECK(result.to_string()));
 	return result;
@@ -1022,3 +1186,30 @@ a65_lexer::token_end(void) const
 	A65_DEBUG_EXIT_INFO("Result=%s", A65_STRING_CHECK(result.to_string()));
 	return result;
 }
+
+const a65_token &
+a65_lexer::token_ref(
+	__in_opt uint32_t id
+	) const
+{
+	std::map<uint32_t, a65_token>::const_iterator result;
+
+	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
+
+	if(id == A65_UUID_INVALID) {
+
+		if(m_token_position >= m_token.size()) {
+			A65_THROW_EXCEPTION_INFO("Token position out-of-range", "%u (max=%u)", m_token_position, m_token.size());
+		}
+
+		id = m_token.at(m_token_position);
+	}
+
+	result = m_token_map.find(id);
+	if(result == m_token_map.end()) {
+		A65_THROW_EXCEPTION_INFO("Token not found", "%u(%x)", id, id);
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%s", A65_STRING_CHECK(result->second.to_string()));
+	return result->second;
+}
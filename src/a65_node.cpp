@@ -15,7 +15,6 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
-
 #include "../inc/a65_node.h"
 #include "../inc/a65_utility.h"
 
@@ -23,24 +22,28 @@ a65_node::a65_node(
 	__in_opt int type,
 	__in_opt uint32_t token,
 	__in_opt uint32_t parent,
-	__in_opt const std::vector<uint32_t> &child
+	__in_opt uint32_t child,
+	__in_opt uint32_t child_count
 	) :
 		m_child(child),
+		m_child_count(child_count),
 		m_parent(parent),
+		m_slot(A65_NODE_SLOT_INVALID),
 		m_token(token),
 		m_type(type)
 {
-	A65_DEBUG_ENTRY_INFO("Type=%u(%s), Token=%u(%x), Parent=%u(%x), Child[%u]=%p", type, A65_NODE_STRING(type),
-		token, token, parent, parent, child.size(), &child);
+	A65_DEBUG_ENTRY_INFO("Type=%u(%s), Token=%u(%x), Parent=%u(%x), Child[%u]=%u", type, A65_NODE_STRING(type),
+		token, token, parent, parent, child_count, child);
 	A65_DEBUG_EXIT();
 }
 
 a65_node::a65_node(
 	__in const a65_node &other
 	) :
-		a65_id(other),
 		m_child(other.m_child),
+		m_child_count(other.m_child_count),
 		m_parent(other.m_parent),
+		m_slot(other.m_slot),
 		m_token(other.m_token),
 		m_type(other.m_type)
 {
@@ -62,9 +65,10 @@ a65_node::operator=(
 	A65_DEBUG_ENTRY();
 
 	if(this != &other) {
-		a65_id::operator=(other);
 		m_child = other.m_child;
+		m_child_count = other.m_child_count;
 		m_parent = other.m_parent;
+		m_slot = other.m_slot;
 		m_token = other.m_token;
 		m_type = other.m_type;
 	}
@@ -73,67 +77,20 @@ a65_node::operator=(
 	return *this;
 }
 
-size_t
-a65_node::add_child(
-	__in uint32_t id,
-	__in_opt size_t position
-	)
-{
-	size_t result;
-
-	A65_DEBUG_ENTRY_INFO("Id=%u(%x), Position=%u", id, id, position);
-
-	result = position;
-	if(result == A65_NODE_POSITION_UNDEFINED) {
-		result = m_child.size();
-	}
-
-	if(result > m_child.size()) {
-		A65_THROW_EXCEPTION_INFO("Node child position too large", "%u (max=%u)", result, m_child.size());
-	}
-
-	if(result < m_child.size()) {
-		m_child.insert(m_child.begin() + result, id);
-	} else {
-		m_child.push_back(id);
-	}
-
-	A65_DEBUG_EXIT_INFO("Result=%u", result);
-	return result;
-}
-
 uint32_t
-a65_node::child(
-	__in size_t position
-	) const
+a65_node::child(void) const
 {
-	uint32_t result;
-
-	A65_DEBUG_ENTRY_INFO("Position=%u", position);
-
-	if(m_child.empty()) {
-		A65_THROW_EXCEPTION("Node is empty");
-	} else if(position >= m_child.size()) {
-		A65_THROW_EXCEPTION_INFO("Node child position out-of-range", "%u (max=%u)", position, m_child.size() - 1);
-	}
-
-	result = m_child.at(position);
-
-	A65_DEBUG_EXIT_INFO("Result=%u(%x)", result, result);
-	return result;
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT_INFO("Result=%u", m_child);
+	return m_child;
 }
 
 size_t
 a65_node::child_count(void) const
 {
-	size_t result;
-
 	A65_DEBUG_ENTRY();
-
-	result = m_child.size();
-
-	A65_DEBUG_EXIT_INFO("Result=%u", result);
-	return result;
+	A65_DEBUG_EXIT_INFO("Result=%u", m_child_count);
+	return m_child_count;
 }
 
 bool
@@ -145,7 +102,7 @@ a65_node::has_child(
 
 	A65_DEBUG_ENTRY_INFO("Position=%u", position);
 
-	result = (position < m_child.size());
+	result = (position < m_child_count);
 
 	A65_DEBUG_EXIT_INFO("Result=%x", result);
 	return result;
@@ -158,7 +115,7 @@ a65_node::has_parent(void) const
 
 	A65_DEBUG_ENTRY();
 
-	result = (m_parent != A65_UUID_INVALID);
+	result = (m_parent != A65_NODE_INVALID);
 
 	A65_DEBUG_EXIT_INFO("Result=%x", result);
 	return result;
@@ -184,7 +141,7 @@ a65_node::is_leaf(void) const
 
 	A65_DEBUG_ENTRY();
 
-	result = m_child.empty();
+	result = !m_child_count;
 
 	A65_DEBUG_EXIT_INFO("Result=%x", result);
 	return result;
@@ -197,7 +154,7 @@ a65_node::is_root(void) const
 
 	A65_DEBUG_ENTRY();
 
-	result = (m_parent == A65_UUID_INVALID);
+	result = (m_parent == A65_NODE_INVALID);
 
 	A65_DEBUG_EXIT_INFO("Result=%x", result);
 	return result;
@@ -226,34 +183,6 @@ a65_node::parent(void) const
 	return m_parent;
 }
 
-void
-a65_node::remove_all_children(void)
-{
-	A65_DEBUG_ENTRY();
-
-	m_child.clear();
-
-	A65_DEBUG_EXIT();
-}
-
-void
-a65_node::remove_child(
-	__in size_t position
-	)
-{
-	A65_DEBUG_ENTRY_INFO("Position=%u", position);
-
-	if(m_child.empty()) {
-		A65_THROW_EXCEPTION("Node is empty");
-	} else if(position >= m_child.size()) {
-		A65_THROW_EXCEPTION_INFO("Node child position out-of-range", "%u (max=%u)", position, m_child.size() - 1);
-	}
-
-	m_child.erase(m_child.begin() + position);
-
-	A65_DEBUG_EXIT();
-}
-
 void
 a65_node::set(
 	__in int type
@@ -268,13 +197,14 @@ a65_node::set(
 
 void
 a65_node::set_child(
-	__in uint32_t id,
-	__in size_t position
+	__in uint32_t child,
+	__in uint32_t child_count
 	)
 {
-	A65_DEBUG_ENTRY_INFO("Id=%u(%x), Position=%u", id, id, position);
+	A65_DEBUG_ENTRY_INFO("Child[%u]=%u", child_count, child);
 
-	m_child.at(position) = id;
+	m_child = child;
+	m_child_count = child_count;
 
 	A65_DEBUG_EXIT();
 }
@@ -291,6 +221,18 @@ a65_node::set_parent(
 	A65_DEBUG_EXIT();
 }
 
+void
+a65_node::set_slot(
+	__in uint32_t slot
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Slot=%u", slot);
+
+	m_slot = slot;
+
+	A65_DEBUG_EXIT();
+}
+
 void
 a65_node::set_token(
 	__in uint32_t id
@@ -303,6 +245,14 @@ a65_node::set_token(
 	A65_DEBUG_EXIT();
 }
 
+uint32_t
+a65_node::slot(void) const
+{
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT_INFO("Result=%u", m_slot);
+	return m_slot;
+}
+
 uint32_t
 a65_node::token(void) const
 {
@@ -318,11 +268,7 @@ a65_node::to_string(void) const
 
 	A65_DEBUG_ENTRY();
 
-	result
-#ifndef NDEBUG
-		<< "{" << a65_id::to_string() << "} "
-#endif // NDEBUG
-		<< "[" << A65_NODE_STRING(m_type) << "] {";
+	result << "[" << A65_NODE_STRING(m_type) << "] {";
 
 	if(is_root()) {
 		result << "Root";
@@ -331,20 +277,7 @@ a65_node::to_string(void) const
 	}
 
 	if(!is_leaf()) {
-		std::vector<uint32_t>::const_iterator child;
-
-		result << ", [" << m_child.size() << "]{";
-
-		for(child = m_child.begin(); child != m_child.end(); ++child) {
-
-			if(child != m_child.begin()) {
-				result << ", ";
-			}
-
-			result << A65_STRING_HEX(uint32_t, *child);
-		}
-
-		result << "}";
+		result << ", [" << m_child_count << "]{" << A65_STRING_HEX(uint32_t, m_child) << "}";
 	}
 
 	result << "}";
@@ -243,6 +243,52 @@ a65_object::empty(void) const
 	return result;
 }
 
+void
+a65_object::expand(
+	__in size_t position,
+	__inout uint8_t *data
+	) const
+{
+	const uint8_t *source;
+	uint32_t length, offset = 0;
+	const a65_object_fill_t *fill_entry;
+	const a65_object_section_t *section;
+
+	A65_DEBUG_ENTRY_INFO("Position=%u, Data=%p", position, data);
+
+	section = &m_payload->section[position];
+	source = &((uint8_t *)m_payload)[section->offset];
+	fill_entry = fill();
+
+	for(uint32_t entry = 0; entry < m_payload->metadata.fill; ++entry, ++fill_entry) {
+
+		if(fill_entry->section == position) {
+			length = (fill_entry->offset - offset);
+			std::memcpy(data, source + offset, length);
+			std::memset(data + length, fill_entry->value, fill_entry->length);
+			data += (length + fill_entry->length);
+			offset = fill_entry->offset;
+		}
+	}
+
+	std::memcpy(data, source + offset, section->size - offset);
+
+	A65_DEBUG_EXIT();
+}
+
+const a65_object_fill_t *
+a65_object::fill(void) const
+{
+	const a65_object_fill_t *result;
+
+	A65_DEBUG_ENTRY();
+
+	result = (const a65_object_fill_t *)&((char *)m_payload)[m_payload_size - (m_payload->metadata.fill * sizeof(a65_object_fill_t))];
+
+	A65_DEBUG_EXIT_INFO("Result[%u]=%p", m_payload->metadata.fill, result);
+	return result;
+}
+
 std::map<std::string, uint32_t>::const_iterator
 a65_object::find(
 	__in const std::string &name
@@ -266,7 +312,8 @@ a65_object::import(
 	__in const std::map<uint16_t, a65_section> &section
 	)
 {
-	uint32_t count = 0, offset;
+	a65_object_fill_t *fill = nullptr;
+	uint32_t count = 0, fill_count = 0, offset;
 	std::map<uint16_t, a65_section>::const_iterator entry;
 
 	A65_DEBUG_ENTRY_INFO("Section[%u]=%p", section.size(), &section);
@@ -281,8 +328,11 @@ a65_object::import(
 		offset = m_payload_size;
 
 		for(entry = section.begin(); entry != section.end(); ++entry) {
-			m_payload_size += entry->second.size();
+			m_payload_size += entry->second.data().size();
+			fill_count += entry->second.fill().size();
 		}
+
+		m_payload_size += (fill_count * sizeof(a65_object_fill_t));
 	}
 
 	m_payload = (a65_object_payload_t *) new uint8_t[m_payload_size];
@@ -293,11 +343,13 @@ a65_object::import(
 	std::memset(m_payload, 0, m_payload_size);
 	m_payload->metadata.count = section.size();
 	m_payload->metadata.size = m_payload_size;
+	m_payload->metadata.fill = fill_count;
+	fill = (a65_object_fill_t *)&((char *)m_payload)[m_payload_size - (fill_count * sizeof(a65_object_fill_t))];
 
 	for(entry = section.begin(); entry != section.end(); ++count, ++entry) {
 		uint32_t size;
-		std::vector<uint8_t> data;
 		std::string name = entry->second.name();
+		const std::vector<uint8_t> &data = entry->second.data();
 
 		if(m_section.find(name) != m_section.end()) {
 			A65_THROW_EXCEPTION_INFO("Duplicate object payload section", "%u, [%u]%s", count, name.size(), A65_STRING_CHECK(name));
@@ -307,12 +359,9 @@ a65_object::import(
 
 		for(size_t iter = 0; iter < entry->second.count(); ++iter) {
 
-			std::vector<uint8_t> subdata = entry->second.data(iter);
-			if(subdata.empty()) {
+			if(!entry->second.length(iter)) {
 				A65_THROW_EXCEPTION_INFO("Object payload section empty", "%u", iter);
 			}
-
-			data.insert(data.end(), subdata.begin(), subdata.end());
 		}
 
 		size = data.size();
@@ -327,8 +376,18 @@ a65_object::import(
 			A65_DEBUG_MESSAGE_INFO(A65_DEBUG_LEVEL_WARNING, "Object section name truncated", "%s", m_payload->section[count].name);
 		}
 
-		std::memcpy(&((char *)m_payload)[offset], &data[0], size);
+		if(size) {
+			std::memcpy(&((char *)m_payload)[offset], data.data(), size);
+		}
 		offset += size;
+
+		for(std::vector<a65_section_fill_t>::const_iterator chunk = entry->second.fill().begin();
+				chunk != entry->second.fill().end(); ++chunk, ++fill) {
+			fill->section = count;
+			fill->offset = chunk->offset;
+			fill->length = chunk->length;
+			fill->value = chunk->value;
+		}
 	}
 
 	A65_DEBUG_EXIT();
@@ -382,6 +441,12 @@ a65_object::import(
 
 		size = payload->metadata.size;
 
+		if((payload->metadata.count > ((size - sizeof(a65_object_payload_t)) / sizeof(a65_object_section_t)))
+				|| (payload->metadata.fill > ((size - sizeof(a65_object_payload_t)) / sizeof(a65_object_fill_t)))) {
+			A65_THROW_EXCEPTION_INFO("Object payload length mismatch", "%u (count=%u, fill=%u)", size, payload->metadata.count,
+				payload->metadata.fill);
+		}
+
 		for(uint32_t entry = 0; entry < payload->metadata.count; ++entry) {
 			std::string name;
 
@@ -407,6 +472,22 @@ a65_object::import(
 			m_section.insert(std::make_pair(name, entry));
 		}
 
+		if(payload->metadata.fill) {
+			a65_object_fill_t *fill = (a65_object_fill_t *)&((char *)payload)[size - (payload->metadata.fill
+				* sizeof(a65_object_fill_t))];
+
+			for(uint32_t entry = 0; entry < payload->metadata.fill; ++entry) {
+
+				if((fill[entry].section >= payload->metadata.count)
+						|| (fill[entry].offset > payload->section[fill[entry].section].size)
+						|| (entry && ((fill[entry].section < fill[entry - 1].section)
+							|| ((fill[entry].section == fill[entry - 1].section)
+								&& (fill[entry].offset < fill[entry - 1].offset))))) {
+					A65_THROW_EXCEPTION_INFO("Malformed object payload fill", "%u", entry);
+				}
+			}
+		}
+
 		m_payload = (a65_object_payload_t *) new uint8_t[size];
 		if(!m_payload) {
 			A65_THROW_EXCEPTION("Object payload allocation failed");
@@ -421,6 +502,58 @@ a65_object::import(
 	A65_DEBUG_EXIT();
 }
 
+uint32_t
+a65_object::length(
+	__in size_t position
+	) const
+{
+	uint32_t result;
+	const a65_object_fill_t *fill_entry;
+
+	A65_DEBUG_ENTRY_INFO("Position=%u", position);
+
+	result = m_payload->section[position].size;
+	fill_entry = fill();
+
+	for(uint32_t entry = 0; entry < m_payload->metadata.fill; ++entry, ++fill_entry) {
+
+		if(fill_entry->section == position) {
+			result += fill_entry->length;
+		}
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+uint16_t
+a65_object::link(
+	__in size_t position,
+	__inout std::vector<uint8_t> &image
+	) const
+{
+	uint16_t result;
+	uint32_t size;
+
+	A65_DEBUG_ENTRY_INFO("Position=%u, Image[%u]=%p", position, image.size(), &image);
+
+	if(!contains_section(position)) {
+		A65_THROW_EXCEPTION_INFO("Object does not contain section", "%u", position);
+	}
+
+	result = m_payload->section[position].origin;
+
+	size = length(position);
+	if((result + size) > image.size()) {
+		A65_THROW_EXCEPTION_INFO("Object section out-of-range", "%u(%04x) (size=%u, max=%u)", result, result, size, image.size());
+	}
+
+	expand(position, &image[result]);
+
+	A65_DEBUG_EXIT_INFO("Result=%u(%04x)", result, result);
+	return result;
+}
+
 void
 a65_object::read(
 	__in const std::string &path
@@ -464,7 +597,6 @@ a65_object::section(
 	) const
 {
 	uint16_t result;
-	a65_object_section_t *section;
 
 	A65_DEBUG_ENTRY_INFO("Position=%u, Data=%p", position, &data);
 
@@ -472,14 +604,12 @@ a65_object::section(
 		A65_THROW_EXCEPTION_INFO("Object does not contain section", "%u", position);
 	}
 
-	section = &m_payload->section[position];
-	if(!section) {
-		A65_THROW_EXCEPTION_INFO("Malformed object payload section", "%u", position);
+	data.resize(length(position));
+	if(!data.empty()) {
+		expand(position, &data[0]);
 	}
 
-	data = std::vector<uint8_t>(((char *)m_payload) + section->offset, ((char *)m_payload) + section->offset + section->size);
-
-	result = section->origin;
+	result = m_payload->section[position].origin;
 
 	A65_DEBUG_EXIT_INFO("Result=%u(%04x)", result, result);
 	return result;
@@ -520,8 +650,9 @@ a65_object::to_string(void) const
 				A65_THROW_EXCEPTION_INFO("Malformed object payload section", "%u", entry);
 			}
 
-			std::vector<uint8_t> data = std::vector<uint8_t>(&((char *)m_payload)[section->offset],
-				&((char *)m_payload)[section->offset] + section->size);
+			std::vector<uint8_t> data;
+
+			a65_object::section(entry, data);
 
 			result << std::endl
 #ifndef NDEBUG
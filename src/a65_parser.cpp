@@ -16,6 +16,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <climits>
 #include "../inc/a65_parser.h"
 #include "../inc/a65_utility.h"
 
@@ -1296,6 +1297,9 @@ a65_parser::enumerate_pragma(
 		case A65_TOKEN_PRAGMA_METADATA:
 			enumerate_pragma_metadata(tree);
 			break;
+		case A65_TOKEN_PRAGMA_ONCE:
+			enumerate_pragma_once(tree);
+			break;
 		default:
 			A65_THROW_EXCEPTION_INFO("Unsupported pragma", "%s", A65_STRING_CHECK(entry.to_string()));
 	}
@@ -1418,6 +1422,27 @@ a65_parser::enumerate_pragma_metadata(
 	A65_DEBUG_EXIT();
 }
 
+void
+a65_parser::enumerate_pragma_once(
+	__inout a65_tree &tree
+	)
+{
+	a65_token entry;
+
+	A65_DEBUG_ENTRY_INFO("Tree=%p", &tree);
+
+	entry = token();
+	add_child_subtree(tree, A65_NODE_PRAGMA, entry.id());
+
+	if(a65_lexer::has_next()) {
+		a65_lexer::move_next();
+	}
+
+	a65_tree::move_parent(tree);
+
+	A65_DEBUG_EXIT();
+}
+
 void
 a65_parser::enumerate_statement_list(
 	__inout a65_tree &tree
@@ -1450,6 +1475,198 @@ a65_parser::enumerate_statement_list(
 	A65_DEBUG_EXIT();
 }
 
+uint16_t
+a65_parser::evaluate_macro(
+	__in int subtype,
+	__in uint16_t value
+	)
+{
+	uint16_t result = value;
+
+	A65_DEBUG_ENTRY_INFO("Subtype=%u(%x), Value=%u(%04x)", subtype, subtype, value, value);
+
+	switch(subtype) {
+		case A65_TOKEN_MACRO_HIGH:
+			result >>= CHAR_BIT;
+			break;
+		case A65_TOKEN_MACRO_LOW:
+			result &= UINT8_MAX;
+			break;
+		default:
+			A65_THROW_EXCEPTION_INFO("Malformed expression tree", "%u(%x)", subtype, subtype);
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u(%04x)", result, result);
+	return result;
+}
+
+uint16_t
+a65_parser::evaluate_operator(
+	__in int subtype,
+	__in uint16_t left,
+	__in uint16_t right
+	)
+{
+	uint16_t result = 0;
+
+	A65_DEBUG_ENTRY_INFO("Subtype=%u(%x), Left=%u(%04x), Right=%u(%04x)", subtype, subtype, left, left, right, right);
+
+	if(!right && A65_IS_TOKEN_SYMBOL_DIVISION(subtype)) {
+		A65_THROW_EXCEPTION_INFO("Division by zero", "%s", A65_TOKEN_SYMBOL_STRING(subtype));
+	}
+
+	switch(subtype) {
+		case A65_TOKEN_SYMBOL_ARITHMETIC_ADDITION:
+			result = (left + right);
+			break;
+		case A65_TOKEN_SYMBOL_ARITHMETIC_DIVIDE:
+			result = (left / right);
+			break;
+		case A65_TOKEN_SYMBOL_ARITHMETIC_MODULUS:
+			result = (left % right);
+			break;
+		case A65_TOKEN_SYMBOL_ARITHMETIC_MULTIPLY:
+			result = (left * right);
+			break;
+		case A65_TOKEN_SYMBOL_ARITHMETIC_SUBTRACTION:
+			result = (left - right);
+			break;
+		case A65_TOKEN_SYMBOL_BINARY_AND:
+			result = (left & right);
+			break;
+		case A65_TOKEN_SYMBOL_BINARY_OR:
+			result = (left | right);
+			break;
+		case A65_TOKEN_SYMBOL_BINARY_XOR:
+			result = (left ^ right);
+			break;
+		case A65_TOKEN_SYMBOL_LOGICAL_AND:
+			result = (left && right);
+			break;
+		case A65_TOKEN_SYMBOL_LOGICAL_OR:
+			result = (left || right);
+			break;
+		case A65_TOKEN_SYMBOL_LOGICAL_SHIFT_LEFT:
+			result = (left << right);
+			break;
+		case A65_TOKEN_SYMBOL_LOGICAL_SHIFT_RIGHT:
+			result = (left >> right);
+			break;
+		default:
+			A65_THROW_EXCEPTION_INFO("Malformed expression tree", "%u(%x)", subtype, subtype);
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u(%04x)", result, result);
+	return result;
+}
+
+uint16_t
+a65_parser::evaluate_unary(
+	__in int subtype,
+	__in uint16_t value
+	)
+{
+	uint16_t result = value;
+
+	A65_DEBUG_ENTRY_INFO("Subtype=%u(%x), Value=%u(%04x)", subtype, subtype, value, value);
+
+	switch(subtype) {
+		case A65_TOKEN_SYMBOL_UNARY_NEGATION:
+			result = ~result;
+			break;
+		case A65_TOKEN_SYMBOL_UNARY_NOT:
+			result = !result;
+			break;
+		default:
+			A65_THROW_EXCEPTION_INFO("Malformed expression tree", "%u(%x)", subtype, subtype);
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u(%04x)", result, result);
+	return result;
+}
+
+void
+a65_parser::export_snapshot(
+	__inout a65_snapshot &snapshot
+	) const
+{
+	std::vector<uint32_t>::const_iterator entry;
+	std::map<uint32_t, uint32_t> index;
+
+	A65_DEBUG_ENTRY_INFO("Snapshot=%p", &snapshot);
+
+	snapshot.clear();
+	a65_lexer::export_snapshot(snapshot, index);
+
+	for(entry = m_tree.begin(); entry != m_tree.end(); ++entry) {
+		a65_tree tree = tree_ref(*entry);
+
+		snapshot.add_tree(tree.type());
+
+		if(tree.has_root()) {
+			tree.move_root();
+			export_snapshot_node(tree, index, snapshot);
+			export_snapshot_child(tree, index, snapshot);
+		}
+	}
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_parser::export_snapshot_child(
+	__inout a65_tree &tree,
+	__in const std::map<uint32_t, uint32_t> &index,
+	__inout a65_snapshot &snapshot
+	)
+{
+	size_t child;
+
+	A65_DEBUG_ENTRY_INFO("Tree=%p, Index=%p, Snapshot=%p", &tree, &index, &snapshot);
+
+	for(child = 0; child < tree.node().child_count(); ++child) {
+		a65_tree::move_child(tree, child);
+		export_snapshot_node(tree, index, snapshot);
+		a65_tree::move_parent(tree);
+	}
+
+	for(child = 0; child < tree.node().child_count(); ++child) {
+		a65_tree::move_child(tree, child);
+		export_snapshot_child(tree, index, snapshot);
+		a65_tree::move_parent(tree);
+	}
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_parser::export_snapshot_node(
+	__inout a65_tree &tree,
+	__in const std::map<uint32_t, uint32_t> &index,
+	__inout a65_snapshot &snapshot
+	)
+{
+	uint32_t token = A65_SNAPSHOT_INVALID;
+
+	A65_DEBUG_ENTRY_INFO("Tree=%p, Index=%p, Snapshot=%p", &tree, &index, &snapshot);
+
+	a65_node &node = tree.node();
+
+	if(node.has_token()) {
+		std::map<uint32_t, uint32_t>::const_iterator entry = index.find(node.token());
+
+		if(entry == index.end()) {
+			A65_THROW_EXCEPTION_INFO("Token not found", "%u(%x)", node.token(), node.token());
+		}
+
+		token = entry->second;
+	}
+
+	snapshot.add_node(node.type(), token, node.child_count());
+
+	A65_DEBUG_EXIT();
+}
+
 std::map<uint32_t, a65_tree>::iterator
 a65_parser::find(
 	__in uint32_t id
@@ -1475,7 +1692,7 @@ a65_parser::has_next(void) const
 
 	A65_DEBUG_ENTRY();
 
-	result = !tree().match(A65_TREE_END);
+	result = !tree_ref().match(A65_TREE_END);
 
 	A65_DEBUG_EXIT_INFO("Result=%x", result);
 	return result;
@@ -1494,6 +1711,98 @@ a65_parser::has_previous(void) const
 	return result;
 }
 
+void
+a65_parser::import_snapshot(
+	__in const a65_snapshot &snapshot,
+	__in const std::string &path
+	)
+{
+	std::vector<uint32_t> id;
+
+	A65_DEBUG_ENTRY_INFO("Snapshot=%p, Path[%u]=%s", &snapshot, path.size(), A65_STRING_CHECK(path));
+
+	a65_lexer::import_snapshot(snapshot, path, id);
+	m_tree.clear();
+	m_tree_map.clear();
+	m_tree_position = 0;
+
+	for(size_t position = 0; position < snapshot.tree_count(); ++position) {
+		a65_tree tree;
+		const a65_snapshot_tree_t &entry = snapshot.tree(position);
+
+		tree.set(entry.type);
+
+		if(entry.node_count) {
+			size_t node = entry.node;
+
+			import_snapshot_node(tree, snapshot, id, node);
+			tree.move_root();
+			import_snapshot_child(tree, snapshot, id, snapshot.node(entry.node).child_count, node);
+			tree.move_root();
+		}
+
+		m_tree.push_back(tree.id());
+		m_tree_map.insert(std::make_pair(tree.id(), tree));
+	}
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_parser::import_snapshot_child(
+	__inout a65_tree &tree,
+	__in const a65_snapshot &snapshot,
+	__in const std::vector<uint32_t> &id,
+	__in size_t count,
+	__inout size_t &position
+	)
+{
+	size_t child, first;
+
+	A65_DEBUG_ENTRY_INFO("Tree=%p, Snapshot=%p, Id=%p, Count=%u, Position=%u", &tree, &snapshot, &id, count, position);
+
+	first = position;
+
+	for(child = 0; child < count; ++child) {
+		import_snapshot_node(tree, snapshot, id, position);
+	}
+
+	for(child = 0; child < count; ++child) {
+		a65_tree::move_child(tree, child);
+		import_snapshot_child(tree, snapshot, id, snapshot.node(first + child).child_count, position);
+		a65_tree::move_parent(tree);
+	}
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_parser::import_snapshot_node(
+	__inout a65_tree &tree,
+	__in const a65_snapshot &snapshot,
+	__in const std::vector<uint32_t> &id,
+	__inout size_t &position
+	)
+{
+	uint32_t token = A65_UUID_INVALID;
+
+	A65_DEBUG_ENTRY_INFO("Tree=%p, Snapshot=%p, Id=%p, Position=%u", &tree, &snapshot, &id, position);
+
+	const a65_snapshot_node_t &entry = snapshot.node(position++);
+
+	if(entry.token != A65_SNAPSHOT_INVALID) {
+		token = id.at(entry.token);
+	}
+
+	if(!tree.has_root()) {
+		tree.add_root(entry.type, token);
+	} else {
+		tree.add_child(entry.type, token);
+	}
+
+	A65_DEBUG_EXIT();
+}
+
 void
 a65_parser::load(
 	__in const std::string &input,
@@ -1517,7 +1826,7 @@ a65_parser::move_next(void)
 		A65_THROW_EXCEPTION("No next tree in parser");
 	}
 
-	if(a65_lexer::token().match(A65_TOKEN_BEGIN)) {
+	if(a65_lexer::token_ref().match(A65_TOKEN_BEGIN)) {
 		a65_lexer::move_next();
 	}
 
@@ -1635,3 +1944,54 @@ a65_parser::tree_end(void) const
 	A65_DEBUG_EXIT_INFO("Result=%s", A65_STRING_CHECK(result.to_string()));
 	return result;
 }
+
+a65_tree &
+a65_parser::tree_ref(
+	__in_opt uint32_t id
+	)
+{
+	std::map<uint32_t, a65_tree>::iterator result;
+
+	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
+
+	if(id == A65_UUID_INVALID) {
+
+		if(m_tree_position >= m_tree.size()) {
+			A65_THROW_EXCEPTION_INFO("Tree position out-of-range", "%u (max=%u)", m_tree_position, m_tree.size());
+		}
+
+		id = m_tree.at(m_tree_position);
+	}
+
+	result = find(id);
+
+	A65_DEBUG_EXIT_INFO("Result=%s", A65_STRING_CHECK(result->second.to_string()));
+	return result->second;
+}
+
+const a65_tree &
+a65_parser::tree_ref(
+	__in_opt uint32_t id
+	) const
+{
+	std::map<uint32_t, a65_tree>::const_iterator result;
+
+	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
+
+	if(id == A65_UUID_INVALID) {
+
+		if(m_tree_position >= m_tree.size()) {
+			A65_THROW_EXCEPTION_INFO("Tree position out-of-range", "%u (max=%u)", m_tree_position, m_tree.size());
+		}
+
+		id = m_tree.at(m_tree_position);
+	}
+
+	result = m_tree_map.find(id);
+	if(result == m_tree_map.end()) {
+		A65_THROW_EXCEPTION_INFO("Tree not found", "%u(%x)", id, id);
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%s", A65_STRING_CHECK(result->second.to_string()));
+	return result->second;
+}
@@ -40,6 +40,8 @@ a65_section::a65_section(
 	__in const a65_section &other
 	) :
 		a65_id(other),
+		m_data(other.m_data),
+		m_fill(other.m_fill),
 		m_listing(other.m_listing),
 		m_name(other.m_name),
 		m_offset(other.m_offset),
@@ -64,6 +66,8 @@ a65_section::operator=(
 
 	if(this != &other) {
 		a65_id::operator=(other);
+		m_data = other.m_data;
+		m_fill = other.m_fill;
 		m_listing = other.m_listing;
 		m_name = other.m_name;
 		m_offset = other.m_offset;
@@ -77,13 +81,44 @@ a65_section::operator=(
 void
 a65_section::add(
 	__in const std::vector<uint8_t> &data,
-	__in uint32_t listing
+	__in uint32_t listing,
+	__in_opt const std::vector<a65_section_fill_t> &fill
 	)
 {
-	A65_DEBUG_ENTRY_INFO("Data[%u]=%p, Listing=%u(%x)", data.size(), &data, listing, listing);
+	a65_section_listing_t entry = {};
+	std::vector<a65_section_fill_t>::const_iterator chunk;
 
-	m_listing.push_back(std::make_tuple(data, listing, m_offset));
-	m_offset += data.size();
+	A65_DEBUG_ENTRY_INFO("Data[%u]=%p, Listing=%u(%x), Fill[%u]=%p", data.size(), &data, listing, listing, fill.size(), &fill);
+
+	entry.length = data.size();
+
+	for(chunk = fill.begin(); chunk != fill.end(); ++chunk) {
+
+		if(chunk->offset > data.size()) {
+			A65_THROW_EXCEPTION_INFO("Section fill out-of-range", "%u (max=%u)", chunk->offset, data.size());
+		}
+
+		entry.length += chunk->length;
+	}
+
+	if((m_offset + entry.length) > A65_SECTION_LENGTH_MAX) {
+		A65_THROW_EXCEPTION_INFO("Section too large", "[%u]%s (max=%u)", m_name.size(), A65_STRING_CHECK(m_name),
+			A65_SECTION_LENGTH_MAX);
+	}
+
+	entry.offset = m_offset;
+	entry.listing = listing;
+	entry.data = m_data.size();
+	entry.fill = m_fill.size();
+	m_listing.push_back(entry);
+
+	for(chunk = fill.begin(); chunk != fill.end(); ++chunk) {
+		m_fill.push_back(*chunk);
+		m_fill.back().offset += entry.data;
+	}
+
+	m_data.insert(m_data.end(), data.begin(), data.end());
+	m_offset += entry.length;
 
 	A65_DEBUG_EXIT();
 }
@@ -93,6 +128,8 @@ a65_section::clear(void)
 {
 	A65_DEBUG_ENTRY();
 
+	m_data.clear();
+	m_fill.clear();
 	m_listing.clear();
 	m_offset = 0;
 	m_origin = 0;
@@ -113,16 +150,38 @@ a65_section::count(void) const
 	return result;
 }
 
+const std::vector<uint8_t> &
+a65_section::data(void) const
+{
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT_INFO("Result[%u]=%p", m_data.size(), &m_data);
+	return m_data;
+}
+
 std::vector<uint8_t>
 a65_section::data(
 	__in size_t position
 	) const
 {
 	std::vector<uint8_t> result;
+	uint32_t fill, fill_end, offset;
+	const a65_section_listing_t *entry = nullptr;
 
 	A65_DEBUG_ENTRY_INFO("Position=%u", position);
 
-	result = std::get<A65_SECTION_DATA>(find(position));
+	entry = &find(position);
+	offset = entry->data;
+	fill_end = ((position + 1) < m_listing.size()) ? m_listing[position + 1].fill : m_fill.size();
+
+	for(fill = entry->fill; fill < fill_end; ++fill) {
+		const a65_section_fill_t &chunk = m_fill[fill];
+
+		result.insert(result.end(), m_data.begin() + offset, m_data.begin() + chunk.offset);
+		result.insert(result.end(), chunk.length, chunk.value);
+		offset = chunk.offset;
+	}
+
+	result.insert(result.end(), m_data.begin() + offset, m_data.begin() + (offset + (entry->length - result.size())));
 
 	A65_DEBUG_EXIT_INFO("Result[%u]=%p", result.size(), &result);
 	return result;
@@ -141,12 +200,20 @@ a65_section::empty(void) const
 	return result;
 }
 
-std::tuple<std::vector<uint8_t>, uint16_t, uint32_t>
+const std::vector<a65_section_fill_t> &
+a65_section::fill(void) const
+{
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT_INFO("Result[%u]=%p", m_fill.size(), &m_fill);
+	return m_fill;
+}
+
+const a65_section_listing_t &
 a65_section::find(
 	__in size_t position
 	) const
 {
-	std::tuple<std::vector<uint8_t>, uint16_t, uint32_t> result;
+	const a65_section_listing_t *result = nullptr;
 
 	A65_DEBUG_ENTRY_INFO("Position=%u", position);
 
@@ -156,13 +223,25 @@ a65_section::find(
 		A65_THROW_EXCEPTION_INFO("Section position out-of-range", "%u (max=%u)", position, m_listing.size() - 1);
 	}
 
-	result = m_listing.at(position);
+	result = &m_listing[position];
 
-	A65_DEBUG_EXIT_INFO("Result={[%u]=%p, %u(%x), %u(%04x)}",
-		std::get<A65_SECTION_DATA>(result).size(), &std::get<A65_SECTION_DATA>(result),
-		std::get<A65_SECTION_LISTING>(result), std::get<A65_SECTION_LISTING>(result),
-		std::get<A65_SECTION_OFFSET>(result), std::get<A65_SECTION_OFFSET>(result));
+	A65_DEBUG_EXIT_INFO("Result={%u(%04x), %u, %u(%x)}", result->offset, result->offset, result->length,
+		result->listing, result->listing);
+	return *result;
+}
 
+size_t
+a65_section::length(
+	__in size_t position
+	) const
+{
+	size_t result;
+
+	A65_DEBUG_ENTRY_INFO("Position=%u", position);
+
+	result = find(position).length;
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
 	return result;
 }
 
@@ -175,7 +254,7 @@ a65_section::listing(
 
 	A65_DEBUG_ENTRY_INFO("Position=%u", position);
 
-	result = std::get<A65_SECTION_LISTING>(find(position));
+	result = find(position).listing;
 
 	A65_DEBUG_EXIT_INFO("Result=%u(%x)", result, result);
 	return result;
@@ -198,7 +277,7 @@ a65_section::offset(
 
 	A65_DEBUG_ENTRY_INFO("Position=%u", position);
 
-	result = std::get<A65_SECTION_OFFSET>(find(position));
+	result = find(position).offset;
 
 	A65_DEBUG_EXIT_INFO("Result=%u(%04x)", result, result);
 	return result;
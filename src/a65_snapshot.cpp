@@ -0,0 +1,692 @@
+/**
+ * A65
+ * Copyright (C) 2018 David Jolly
+ *
+ * A65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../inc/a65_snapshot.h"
+#include "../inc/a65_utility.h"
+#ifdef A65_SNAPSHOT_CACHE_SUPPORTED
+#include <sys/stat.h>
+#endif // A65_SNAPSHOT_CACHE_SUPPORTED
+
+static std::map<std::string, std::pair<a65_snapshot_identity_t, std::shared_ptr<const a65_snapshot>>> g_cache;
+
+static std::mutex g_cache_mutex;
+
+a65_snapshot::a65_snapshot(void) :
+		m_source({})
+{
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT();
+}
+
+a65_snapshot::a65_snapshot(
+	__in const a65_snapshot &other
+	) :
+		m_define(other.m_define),
+		m_node(other.m_node),
+		m_source(other.m_source),
+		m_string(other.m_string),
+		m_string_index(other.m_string_index),
+		m_token(other.m_token),
+		m_token_sequence(other.m_token_sequence),
+		m_tree(other.m_tree)
+{
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT();
+}
+
+a65_snapshot::~a65_snapshot(void)
+{
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT();
+}
+
+a65_snapshot &
+a65_snapshot::operator=(
+	__in const a65_snapshot &other
+	)
+{
+	A65_DEBUG_ENTRY();
+
+	if(this != &other) {
+		m_define = other.m_define;
+		m_node = other.m_node;
+		m_source = other.m_source;
+		m_string = other.m_string;
+		m_string_index = other.m_string_index;
+		m_token = other.m_token;
+		m_token_sequence = other.m_token_sequence;
+		m_tree = other.m_tree;
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%p", this);
+	return *this;
+}
+
+void
+a65_snapshot::add_define(
+	__in uint16_t value
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Value=%u(%04x)", value, value);
+
+	m_define.push_back(value);
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_snapshot::add_node(
+	__in int type,
+	__in uint32_t token,
+	__in size_t child_count
+	)
+{
+	a65_snapshot_node_t entry = {};
+
+	A65_DEBUG_ENTRY_INFO("Type=%i, Token=%u(%x), Child=%u", type, token, token, child_count);
+
+	if(m_tree.empty()) {
+		A65_THROW_EXCEPTION_INFO("Snapshot tree undefined", "%i", type);
+	}
+
+	entry.type = type;
+	entry.token = token;
+	entry.child_count = child_count;
+	m_node.push_back(entry);
+	++m_tree.back().node_count;
+
+	A65_DEBUG_EXIT();
+}
+
+uint32_t
+a65_snapshot::add_string(
+	__in const std::string &value
+	)
+{
+	uint32_t result = A65_SNAPSHOT_INVALID;
+
+	A65_DEBUG_ENTRY_INFO("Value[%u]=%s", value.size(), A65_STRING_CHECK(value));
+
+	if(!value.empty()) {
+		std::unordered_map<std::string, uint32_t>::iterator entry = m_string_index.find(value);
+
+		if(entry == m_string_index.end()) {
+			result = m_string.size();
+			m_string.push_back(value);
+			m_string_index.insert(std::make_pair(value, result));
+		} else {
+			result = entry->second;
+		}
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u(%x)", result, result);
+	return result;
+}
+
+uint32_t
+a65_snapshot::add_token(
+	__in const a65_token &token
+	)
+{
+	uint32_t result;
+	a65_snapshot_token_t entry = {};
+
+	A65_DEBUG_ENTRY_INFO("Token=%s", A65_STRING_CHECK(token.to_string()));
+
+	entry.type = token.type();
+	entry.subtype = token.subtype();
+	entry.mode = token.mode();
+	entry.scalar = token.scalar();
+	entry.file = add_string(token.path());
+	entry.literal = add_string(token.literal());
+	entry.line = token.line();
+	entry.column = token.column();
+
+	result = m_token.size();
+	m_token.push_back(entry);
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+void
+a65_snapshot::add_token_sequence(
+	__in uint32_t token
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Token=%u", token);
+
+	if(token >= m_token.size()) {
+		A65_THROW_EXCEPTION_INFO("Snapshot token position out-of-range", "%u (max=%u)", token, m_token.size());
+	}
+
+	m_token_sequence.push_back(token);
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_snapshot::add_tree(
+	__in int type
+	)
+{
+	a65_snapshot_tree_t entry = {};
+
+	A65_DEBUG_ENTRY_INFO("Type=%i", type);
+
+	entry.type = type;
+	entry.node = m_node.size();
+	m_tree.push_back(entry);
+
+	A65_DEBUG_EXIT();
+}
+
+std::vector<uint8_t>
+a65_snapshot::as_data(void) const
+{
+	std::vector<uint8_t> result;
+	a65_object_header_t header = {};
+	std::vector<uint32_t> string_size;
+	a65_snapshot_payload_metadata_t metadata = {};
+	a65_snapshot_payload_source_t source = {};
+
+	A65_DEBUG_ENTRY();
+
+	header.magic = A65_OBJECT_MAGIC;
+	header.metadata.major = A65_VERSION_MAJOR;
+	header.metadata.minor = A65_VERSION_MINOR;
+	header.metadata.type = A65_SNAPSHOT_TYPE;
+	metadata.revision = A65_VERSION_REVISION;
+	metadata.size = m_source.size;
+	metadata.time = m_source.time;
+	metadata.change = m_source.change;
+	source.path_size = m_source.path.size();
+	metadata.define = m_define.size();
+	metadata.node = m_node.size();
+	metadata.sequence = m_token_sequence.size();
+	metadata.string = m_string.size();
+	metadata.token = m_token.size();
+	metadata.tree = m_tree.size();
+
+	for(std::vector<std::string>::const_iterator entry = m_string.begin(); entry != m_string.end(); ++entry) {
+		string_size.push_back(entry->size());
+		metadata.string_size += entry->size();
+	}
+
+	result.insert(result.end(), (uint8_t *)&header, ((uint8_t *)&header) + sizeof(header));
+	result.insert(result.end(), (uint8_t *)&source, ((uint8_t *)&source) + sizeof(source));
+	result.insert(result.end(), m_source.path.begin(), m_source.path.end());
+	result.insert(result.end(), (uint8_t *)&metadata, ((uint8_t *)&metadata) + sizeof(metadata));
+	result.insert(result.end(), (const uint8_t *)m_define.data(), (const uint8_t *)(m_define.data() + m_define.size()));
+	result.insert(result.end(), (const uint8_t *)m_node.data(), (const uint8_t *)(m_node.data() + m_node.size()));
+	result.insert(result.end(), (const uint8_t *)m_token_sequence.data(),
+		(const uint8_t *)(m_token_sequence.data() + m_token_sequence.size()));
+	result.insert(result.end(), (const uint8_t *)string_size.data(), (const uint8_t *)(string_size.data() + string_size.size()));
+
+	for(std::vector<std::string>::const_iterator entry = m_string.begin(); entry != m_string.end(); ++entry) {
+		result.insert(result.end(), entry->begin(), entry->end());
+	}
+
+	result.insert(result.end(), (const uint8_t *)m_token.data(), (const uint8_t *)(m_token.data() + m_token.size()));
+	result.insert(result.end(), (const uint8_t *)m_tree.data(), (const uint8_t *)(m_tree.data() + m_tree.size()));
+
+	A65_DEBUG_EXIT_INFO("Result[%u]=%p", result.size(), &result);
+	return result;
+}
+
+void
+a65_snapshot::clear(void)
+{
+	A65_DEBUG_ENTRY();
+
+	m_define.clear();
+	m_node.clear();
+	m_source = {};
+	m_string.clear();
+	m_string_index.clear();
+	m_token.clear();
+	m_token_sequence.clear();
+	m_tree.clear();
+
+	A65_DEBUG_EXIT();
+}
+
+uint16_t
+a65_snapshot::define(
+	__in size_t position
+	) const
+{
+	uint16_t result;
+
+	A65_DEBUG_ENTRY_INFO("Position=%u", position);
+
+	if(position >= m_define.size()) {
+		A65_THROW_EXCEPTION_INFO("Snapshot define position out-of-range", "%u (max=%u)", position, m_define.size());
+	}
+
+	result = m_define[position];
+
+	A65_DEBUG_EXIT_INFO("Result=%u(%04x)", result, result);
+	return result;
+}
+
+size_t
+a65_snapshot::define_count(void) const
+{
+	size_t result;
+
+	A65_DEBUG_ENTRY();
+
+	result = m_define.size();
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+std::shared_ptr<const a65_snapshot>
+a65_snapshot::find(
+	__in const a65_snapshot_identity_t &identity
+	)
+{
+	std::shared_ptr<const a65_snapshot> result;
+
+	A65_DEBUG_ENTRY_INFO("Identity[%u]=%s", identity.path.size(), A65_STRING_CHECK(identity.path));
+
+	std::lock_guard<std::mutex> lock(g_cache_mutex);
+	std::map<std::string, std::pair<a65_snapshot_identity_t, std::shared_ptr<const a65_snapshot>>>::iterator entry
+		= g_cache.find(identity.path);
+
+	if(entry != g_cache.end()) {
+
+		if((entry->second.first.device == identity.device)
+				&& (entry->second.first.inode == identity.inode)
+				&& (entry->second.first.size == identity.size)
+				&& (entry->second.first.time == identity.time)
+				&& (entry->second.first.change == identity.change)) {
+			result = entry->second.second;
+		} else {
+			g_cache.erase(entry);
+		}
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%p", result.get());
+	return result;
+}
+
+bool
+a65_snapshot::identify(
+	__in const std::string &path,
+	__inout a65_snapshot_identity_t &identity
+	)
+{
+	bool result = false;
+
+	A65_DEBUG_ENTRY_INFO("Path[%u]=%s, Identity=%p", path.size(), A65_STRING_CHECK(path), &identity);
+
+#ifdef A65_SNAPSHOT_CACHE_SUPPORTED
+	char *canonical;
+
+	canonical = realpath(path.c_str(), nullptr);
+	if(canonical) {
+		struct stat status;
+
+		if(!stat(canonical, &status) && S_ISREG(status.st_mode)) {
+			identity.path = canonical;
+			identity.device = status.st_dev;
+			identity.inode = status.st_ino;
+			identity.size = status.st_size;
+			identity.time = A65_SNAPSHOT_TIME_MODIFY(status);
+			identity.change = A65_SNAPSHOT_TIME_CHANGE(status);
+			result = true;
+		}
+
+		free(canonical);
+	}
+#endif // A65_SNAPSHOT_CACHE_SUPPORTED
+
+	A65_DEBUG_EXIT_INFO("Result=%x", result);
+	return result;
+}
+
+bool
+a65_snapshot::import(
+	__in const a65_buffer &buffer
+	)
+{
+	bool result = false;
+	size_t offset = 0;
+	const uint8_t *data;
+	const a65_object_header_t *header;
+	const a65_snapshot_payload_metadata_t *metadata;
+	const a65_snapshot_payload_source_t *source;
+
+	A65_DEBUG_ENTRY_INFO("Buffer=%s", A65_STRING_CHECK(buffer.to_string()));
+
+	data = (const uint8_t *) buffer.data();
+
+	offset = (sizeof(a65_object_header_t) + sizeof(a65_snapshot_payload_source_t));
+	if(buffer.length() < offset) {
+		A65_THROW_EXCEPTION_INFO("Invalid snapshot length", "%u (min=%u)", buffer.length(), offset);
+	}
+
+	header = (const a65_object_header_t *)data;
+	source = (const a65_snapshot_payload_source_t *)(data + sizeof(a65_object_header_t));
+
+	if(header->magic != A65_OBJECT_MAGIC) {
+		A65_THROW_EXCEPTION_INFO("Snapshot header mismatch", "Magic=%u(%08x) (expecting=%u(%08x))", header->magic, header->magic,
+			A65_OBJECT_MAGIC, A65_OBJECT_MAGIC);
+	} else if(header->metadata.type != A65_SNAPSHOT_TYPE) {
+		A65_THROW_EXCEPTION_INFO("Snapshot header mismatch", "Type=%u(%04x) (expecting=%u(%04x))", header->metadata.type,
+			header->metadata.type, A65_SNAPSHOT_TYPE, A65_SNAPSHOT_TYPE);
+	} else if((buffer.length() - offset) < source->path_size) {
+		A65_THROW_EXCEPTION_INFO("Snapshot path length mismatch", "%u (max=%u)", source->path_size, buffer.length() - offset);
+	}
+
+	clear();
+	m_source.path.assign((const char *)(data + offset), source->path_size);
+	offset += source->path_size;
+	metadata = (const a65_snapshot_payload_metadata_t *)(data + offset);
+
+	if((header->metadata.major == A65_VERSION_MAJOR)
+			&& (header->metadata.minor == A65_VERSION_MINOR)
+			&& ((buffer.length() - offset) >= sizeof(a65_snapshot_payload_metadata_t))
+			&& (metadata->revision == A65_VERSION_REVISION)) {
+		std::vector<uint32_t> size;
+		uint64_t length, string_size = 0;
+
+		offset += sizeof(a65_snapshot_payload_metadata_t);
+		length = offset
+			+ ((uint64_t) metadata->define * sizeof(uint16_t))
+			+ ((uint64_t) metadata->node * sizeof(a65_snapshot_node_t))
+			+ ((uint64_t) metadata->sequence * sizeof(uint32_t))
+			+ ((uint64_t) metadata->string * sizeof(uint32_t)) + metadata->string_size
+			+ ((uint64_t) metadata->token * sizeof(a65_snapshot_token_t))
+			+ ((uint64_t) metadata->tree * sizeof(a65_snapshot_tree_t));
+
+		if(length != buffer.length()) {
+			A65_THROW_EXCEPTION_INFO("Snapshot payload length mismatch", "%u (expecting=%u)", buffer.length(), length);
+		}
+
+		m_source.size = metadata->size;
+		m_source.time = metadata->time;
+		m_source.change = metadata->change;
+
+		m_define.resize(metadata->define);
+		std::copy(data + offset, data + offset + (m_define.size() * sizeof(uint16_t)),
+			(uint8_t *) m_define.data());
+		offset += (m_define.size() * sizeof(uint16_t));
+
+		m_node.resize(metadata->node);
+		std::copy(data + offset, data + offset + (m_node.size() * sizeof(a65_snapshot_node_t)),
+			(uint8_t *) m_node.data());
+		offset += (m_node.size() * sizeof(a65_snapshot_node_t));
+
+		m_token_sequence.resize(metadata->sequence);
+		std::copy(data + offset, data + offset + (m_token_sequence.size() * sizeof(uint32_t)),
+			(uint8_t *) m_token_sequence.data());
+		offset += (m_token_sequence.size() * sizeof(uint32_t));
+
+		size.resize(metadata->string);
+		std::copy(data + offset, data + offset + (size.size() * sizeof(uint32_t)),
+			(uint8_t *) size.data());
+		offset += (size.size() * sizeof(uint32_t));
+
+		for(std::vector<uint32_t>::iterator entry = size.begin(); entry != size.end(); ++entry) {
+			string_size += *entry;
+
+			if(string_size > metadata->string_size) {
+				A65_THROW_EXCEPTION_INFO("Snapshot string length mismatch", "%u (max=%u)", string_size, metadata->string_size);
+			}
+
+			m_string_index.insert(std::make_pair(std::string((const char *)(data + offset), *entry), m_string.size()));
+			m_string.push_back(std::string((const char *)(data + offset), *entry));
+			offset += *entry;
+		}
+
+		if(string_size != metadata->string_size) {
+			A65_THROW_EXCEPTION_INFO("Snapshot string length mismatch", "%u (expecting=%u)", string_size, metadata->string_size);
+		}
+
+		m_token.resize(metadata->token);
+		std::copy(data + offset, data + offset + (m_token.size() * sizeof(a65_snapshot_token_t)),
+			(uint8_t *) m_token.data());
+		offset += (m_token.size() * sizeof(a65_snapshot_token_t));
+
+		m_tree.resize(metadata->tree);
+		std::copy(data + offset, data + offset + (m_tree.size() * sizeof(a65_snapshot_tree_t)),
+			(uint8_t *) m_tree.data());
+		result = true;
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%x", result);
+	return result;
+}
+
+void
+a65_snapshot::insert(
+	__in const a65_snapshot_identity_t &identity,
+	__in const std::shared_ptr<const a65_snapshot> &snapshot
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Identity[%u]=%s, Snapshot=%p", identity.path.size(), A65_STRING_CHECK(identity.path), snapshot.get());
+
+	std::lock_guard<std::mutex> lock(g_cache_mutex);
+	g_cache[identity.path] = std::make_pair(identity, snapshot);
+
+	A65_DEBUG_EXIT();
+}
+
+const a65_snapshot_node_t &
+a65_snapshot::node(
+	__in size_t position
+	) const
+{
+	A65_DEBUG_ENTRY_INFO("Position=%u", position);
+
+	if(position >= m_node.size()) {
+		A65_THROW_EXCEPTION_INFO("Snapshot node position out-of-range", "%u (max=%u)", position, m_node.size());
+	}
+
+	A65_DEBUG_EXIT();
+	return m_node[position];
+}
+
+bool
+a65_snapshot::read(
+	__in const std::string &path
+	)
+{
+	bool result;
+	a65_buffer buffer(path, true);
+
+	A65_DEBUG_ENTRY_INFO("Path[%u]=%s", path.size(), A65_STRING_CHECK(path));
+
+	result = import(buffer);
+
+	A65_DEBUG_EXIT_INFO("Result=%x", result);
+	return result;
+}
+
+uint32_t
+a65_snapshot::sequence(
+	__in size_t position
+	) const
+{
+	uint32_t result;
+
+	A65_DEBUG_ENTRY_INFO("Position=%u", position);
+
+	if(position >= m_token_sequence.size()) {
+		A65_THROW_EXCEPTION_INFO("Snapshot sequence position out-of-range", "%u (max=%u)", position, m_token_sequence.size());
+	}
+
+	result = m_token_sequence[position];
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+size_t
+a65_snapshot::sequence_count(void) const
+{
+	size_t result;
+
+	A65_DEBUG_ENTRY();
+
+	result = m_token_sequence.size();
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+void
+a65_snapshot::set_source(
+	__in const a65_snapshot_identity_t &source
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Source[%u]=%s", source.path.size(), A65_STRING_CHECK(source.path));
+
+	m_source = source;
+
+	A65_DEBUG_EXIT();
+}
+
+const a65_snapshot_identity_t &
+a65_snapshot::source(void) const
+{
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT();
+	return m_source;
+}
+
+const std::string &
+a65_snapshot::string(
+	__in uint32_t position
+	) const
+{
+	static const std::string empty;
+	const std::string *result = &empty;
+
+	A65_DEBUG_ENTRY_INFO("Position=%u(%x)", position, position);
+
+	if(position != A65_SNAPSHOT_INVALID) {
+
+		if(position >= m_string.size()) {
+			A65_THROW_EXCEPTION_INFO("Snapshot string position out-of-range", "%u (max=%u)", position, m_string.size());
+		}
+
+		result = &m_string[position];
+	}
+
+	A65_DEBUG_EXIT_INFO("Result[%u]=%s", result->size(), A65_STRING_CHECK(*result));
+	return *result;
+}
+
+size_t
+a65_snapshot::string_count(void) const
+{
+	size_t result;
+
+	A65_DEBUG_ENTRY();
+
+	result = m_string.size();
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+std::string
+a65_snapshot::to_string(void) const
+{
+	std::stringstream result;
+
+	A65_DEBUG_ENTRY();
+
+	result << "Token[" << m_token.size() << "], Tree[" << m_tree.size() << "], Node[" << m_node.size()
+		<< "], String[" << m_string.size() << "], Define[" << m_define.size() << "]";
+
+	A65_DEBUG_EXIT();
+	return result.str();
+}
+
+const a65_snapshot_token_t &
+a65_snapshot::token(
+	__in size_t position
+	) const
+{
+	A65_DEBUG_ENTRY_INFO("Position=%u", position);
+
+	if(position >= m_token.size()) {
+		A65_THROW_EXCEPTION_INFO("Snapshot token position out-of-range", "%u (max=%u)", position, m_token.size());
+	}
+
+	A65_DEBUG_EXIT();
+	return m_token[position];
+}
+
+size_t
+a65_snapshot::token_count(void) const
+{
+	size_t result;
+
+	A65_DEBUG_ENTRY();
+
+	result = m_token.size();
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+const a65_snapshot_tree_t &
+a65_snapshot::tree(
+	__in size_t position
+	) const
+{
+	A65_DEBUG_ENTRY_INFO("Position=%u", position);
+
+	if(position >= m_tree.size()) {
+		A65_THROW_EXCEPTION_INFO("Snapshot tree position out-of-range", "%u (max=%u)", position, m_tree.size());
+	}
+
+	A65_DEBUG_EXIT();
+	return m_tree[position];
+}
+
+size_t
+a65_snapshot::tree_count(void) const
+{
+	size_t result;
+
+	A65_DEBUG_ENTRY();
+
+	result = m_tree.size();
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+void
+a65_snapshot::write(
+	__in const std::string &path
+	) const
+{
+	A65_DEBUG_ENTRY_INFO("Path[%u]=%s", path.size(), A65_STRING_CHECK(path));
+
+	a65_utility::write_file(path, as_data());
+
+	A65_DEBUG_EXIT();
+}
@@ -36,6 +36,7 @@ a65_stream::a65_stream(
 a65_stream::a65_stream(
 	__in const a65_stream &other
 	) :
+		m_buffer(other.m_buffer),
 		m_character(other.m_character),
 		m_character_position(other.m_character_position),
 		m_line(other.m_line),
@@ -60,6 +61,7 @@ a65_stream::operator=(
 	A65_DEBUG_ENTRY();
 
 	if(this != &other) {
+		m_buffer = other.m_buffer;
 		m_character = other.m_character;
 		m_character_position = other.m_character_position;
 		m_line = other.m_line;
@@ -91,22 +93,10 @@ int
 a65_stream::character_type(void) const
 {
 	int result;
-	char value;
 
 	A65_DEBUG_ENTRY();
 
-	value = character();
-	if(value == A65_CHARACTER_END) {
-		result = A65_STREAM_CHARACTER_END;
-	} else if(std::isalpha(value)) {
-		result = A65_STREAM_CHARACTER_ALPHA;
-	} else if(std::isdigit(value)) {
-		result = A65_STREAM_CHARACTER_DIGIT;
-	} else if(std::isspace(value)) {
-		result = A65_STREAM_CHARACTER_SPACE;
-	} else {
-		result = A65_STREAM_CHARACTER_SYMBOL;
-	}
+	result = A65_STREAM_CHARACTER_CLASS(character());
 
 	A65_DEBUG_EXIT_INFO("Result=%i(%s)", result, A65_STREAM_CHARACTER_STRING(result));
 	return result;
@@ -117,8 +107,8 @@ a65_stream::clear(void)
 {
 	A65_DEBUG_ENTRY();
 
-	m_character.clear();
-	m_character.push_back(A65_CHARACTER_END);
+	m_buffer = std::make_shared<a65_buffer>();
+	m_character = std::string_view(m_buffer->data(), m_buffer->size());
 	m_character_position = 0;
 	m_line = A65_STREAM_LINE_START;
 	m_path.clear();
@@ -126,6 +116,21 @@ a65_stream::clear(void)
 	A65_DEBUG_EXIT();
 }
 
+size_t
+a65_stream::column(void) const
+{
+	size_t position, result = A65_STREAM_COLUMN_START;
+
+	A65_DEBUG_ENTRY();
+
+	for(position = m_character_position; position && (m_character.at(position - 1) != A65_CHARACTER_NEWLINE); --position) {
+		++result;
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
 bool
 a65_stream::has_next(void) const
 {
@@ -174,7 +179,7 @@ a65_stream::is_decimal(void) const
 
 	A65_DEBUG_ENTRY();
 
-	result = (std::isdigit(character()) > 0);
+	result = A65_IS_STREAM_CHARACTER_FLAG(character(), A65_STREAM_CHARACTER_FLAG_DECIMAL);
 
 	A65_DEBUG_EXIT_INFO("Result=%x", result);
 	return result;
@@ -187,7 +192,7 @@ a65_stream::is_hexidecimal(void) const
 
 	A65_DEBUG_ENTRY();
 
-	result = (std::isxdigit(character()) > 0);
+	result = A65_IS_STREAM_CHARACTER_FLAG(character(), A65_STREAM_CHARACTER_FLAG_HEXIDECIMAL);
 
 	A65_DEBUG_EXIT_INFO("Result=%x", result);
 	return result;
@@ -226,15 +231,9 @@ a65_stream::load(
 
 	a65_stream::clear();
 
-	if(is_path) {
-		a65_utility::read_file(input, m_character);
-		m_path = input;
-	} else {
-		m_character = input;
-		m_path = A65_STRING_UNKNOWN;
-	}
-
-	m_character.push_back(A65_CHARACTER_END);
+	m_buffer = std::make_shared<a65_buffer>(input, is_path);
+	m_character = std::string_view(m_buffer->data(), m_buffer->size());
+	m_path = (is_path ? input : A65_STRING_UNKNOWN);
 
 	A65_DEBUG_EXIT();
 }
@@ -280,7 +279,7 @@ a65_stream::move_next(void)
 		A65_THROW_EXCEPTION("No next character in stream");
 	}
 
-	if(match(A65_STREAM_CHARACTER_SPACE, A65_CHARACTER_NEWLINE)) {
+	if(m_character[m_character_position] == A65_CHARACTER_NEWLINE) {
 		++m_line;
 	}
 
@@ -326,6 +325,241 @@ a65_stream::reset(void)
 	A65_DEBUG_EXIT();
 }
 
+size_t
+a65_stream::scan_line(
+	__in const char *data,
+	__in size_t position,
+	__in size_t length
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Data=%p, Position=%u, Length=%u", data, position, length);
+
+	switch(scan_mode()) {
+		case A65_STREAM_SCAN_AVX2:
+			position = scan_line_avx2(data, position, length);
+			break;
+		case A65_STREAM_SCAN_SSE2:
+			position = scan_line_sse2(data, position, length);
+			break;
+		default:
+			break;
+	}
+
+	while((data[position] != A65_CHARACTER_NEWLINE) && (data[position] != A65_CHARACTER_END)) {
+		++position;
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u", position);
+	return position;
+}
+
+A65_STREAM_SCAN_TARGET_AVX2 size_t
+a65_stream::scan_line_avx2(
+	__in const char *data,
+	__in size_t position,
+	__in size_t length
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Data=%p, Position=%u, Length=%u", data, position, length);
+
+#ifdef A65_STREAM_SCAN_X86
+	__m256i end, newline;
+
+	end = _mm256_setzero_si256();
+	newline = _mm256_set1_epi8(A65_CHARACTER_NEWLINE);
+
+	while((position + A65_STREAM_SCAN_WIDTH_AVX2) <= length) {
+		uint32_t mask;
+		__m256i block;
+
+		block = _mm256_loadu_si256((const __m256i *) (data + position));
+		mask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(block, newline), _mm256_cmpeq_epi8(block, end)));
+		if(mask) {
+			position += __builtin_ctz(mask);
+			break;
+		}
+
+		position += A65_STREAM_SCAN_WIDTH_AVX2;
+	}
+#endif // A65_STREAM_SCAN_X86
+
+	A65_DEBUG_EXIT_INFO("Result=%u", position);
+	return position;
+}
+
+A65_STREAM_SCAN_TARGET_SSE2 size_t
+a65_stream::scan_line_sse2(
+	__in const char *data,
+	__in size_t position,
+	__in size_t length
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Data=%p, Position=%u, Length=%u", data, position, length);
+
+#ifdef A65_STREAM_SCAN_X86
+	__m128i end, newline;
+
+	end = _mm_setzero_si128();
+	newline = _mm_set1_epi8(A65_CHARACTER_NEWLINE);
+
+	while((position + A65_STREAM_SCAN_WIDTH_SSE2) <= length) {
+		uint32_t mask;
+		__m128i block;
+
+		block = _mm_loadu_si128((const __m128i *) (data + position));
+		mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, newline), _mm_cmpeq_epi8(block, end)));
+		if(mask) {
+			position += __builtin_ctz(mask);
+			break;
+		}
+
+		position += A65_STREAM_SCAN_WIDTH_SSE2;
+	}
+#endif // A65_STREAM_SCAN_X86
+
+	A65_DEBUG_EXIT_INFO("Result=%u", position);
+	return position;
+}
+
+int
+a65_stream::scan_mode(void)
+{
+#ifdef A65_STREAM_SCAN_X86
+	static const int result = (__builtin_cpu_supports("avx2") ? A65_STREAM_SCAN_AVX2
+		: (__builtin_cpu_supports("sse2") ? A65_STREAM_SCAN_SSE2 : A65_STREAM_SCAN_SCALAR));
+#else
+	static const int result = A65_STREAM_SCAN_SCALAR;
+#endif // A65_STREAM_SCAN_X86
+
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT_INFO("Result=%i(%s)", result, A65_STREAM_SCAN_STRING(result));
+	return result;
+}
+
+size_t
+a65_stream::scan_space(
+	__in const char *data,
+	__in size_t position,
+	__in size_t length,
+	__inout size_t &line
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Data=%p, Position=%u, Length=%u, Line=%u", data, position, length, line);
+
+	switch(scan_mode()) {
+		case A65_STREAM_SCAN_AVX2:
+			position = scan_space_avx2(data, position, length, line);
+			break;
+		case A65_STREAM_SCAN_SSE2:
+			position = scan_space_sse2(data, position, length, line);
+			break;
+		default:
+			break;
+	}
+
+	while(A65_STREAM_CHARACTER_CLASS(data[position]) == A65_STREAM_CHARACTER_SPACE) {
+
+		if(data[position] == A65_CHARACTER_NEWLINE) {
+			++line;
+		}
+
+		++position;
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u, Line=%u", position, line);
+	return position;
+}
+
+A65_STREAM_SCAN_TARGET_AVX2 size_t
+a65_stream::scan_space_avx2(
+	__in const char *data,
+	__in size_t position,
+	__in size_t length,
+	__inout size_t &line
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Data=%p, Position=%u, Length=%u, Line=%u", data, position, length, line);
+
+#ifdef A65_STREAM_SCAN_X86
+	__m256i low, newline, range, space;
+
+	low = _mm256_set1_epi8(A65_STREAM_SCAN_SPACE_LOW);
+	newline = _mm256_set1_epi8(A65_CHARACTER_NEWLINE);
+	range = _mm256_set1_epi8(A65_STREAM_SCAN_SPACE_HIGH - A65_STREAM_SCAN_SPACE_LOW);
+	space = _mm256_set1_epi8(A65_STREAM_SCAN_SPACE);
+
+	while((position + A65_STREAM_SCAN_WIDTH_AVX2) <= length) {
+		__m256i block, offset;
+		uint32_t mask_newline, mask_space;
+
+		block = _mm256_loadu_si256((const __m256i *) (data + position));
+		offset = _mm256_sub_epi8(block, low);
+		mask_space = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(block, space),
+			_mm256_cmpeq_epi8(_mm256_min_epu8(offset, range), offset)));
+		mask_newline = _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newline));
+
+		if(mask_space != UINT32_MAX) {
+			uint32_t index = __builtin_ctz(~mask_space);
+
+			line += __builtin_popcount(mask_newline & ((1U << index) - 1));
+			position += index;
+			break;
+		}
+
+		line += __builtin_popcount(mask_newline);
+		position += A65_STREAM_SCAN_WIDTH_AVX2;
+	}
+#endif // A65_STREAM_SCAN_X86
+
+	A65_DEBUG_EXIT_INFO("Result=%u, Line=%u", position, line);
+	return position;
+}
+
+A65_STREAM_SCAN_TARGET_SSE2 size_t
+a65_stream::scan_space_sse2(
+	__in const char *data,
+	__in size_t position,
+	__in size_t length,
+	__inout size_t &line
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Data=%p, Position=%u, Length=%u, Line=%u", data, position, length, line);
+
+#ifdef A65_STREAM_SCAN_X86
+	__m128i low, newline, range, space;
+
+	low = _mm_set1_epi8(A65_STREAM_SCAN_SPACE_LOW);
+	newline = _mm_set1_epi8(A65_CHARACTER_NEWLINE);
+	range = _mm_set1_epi8(A65_STREAM_SCAN_SPACE_HIGH - A65_STREAM_SCAN_SPACE_LOW);
+	space = _mm_set1_epi8(A65_STREAM_SCAN_SPACE);
+
+	while((position + A65_STREAM_SCAN_WIDTH_SSE2) <= length) {
+		__m128i block, offset;
+		uint32_t mask_newline, mask_space;
+
+		block = _mm_loadu_si128((const __m128i *) (data + position));
+		offset = _mm_sub_epi8(block, low);
+		mask_space = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, space),
+			_mm_cmpeq_epi8(_mm_min_epu8(offset, range), offset)));
+		mask_newline = _mm_movemask_epi8(_mm_cmpeq_epi8(block, newline));
+
+		if(mask_space != UINT16_MAX) {
+			uint32_t index = __builtin_ctz(~mask_space);
+
+			line += __builtin_popcount(mask_newline & ((1U << index) - 1));
+			position += index;
+			break;
+		}
+
+		line += __builtin_popcount(mask_newline);
+		position += A65_STREAM_SCAN_WIDTH_SSE2;
+	}
+#endif // A65_STREAM_SCAN_X86
+
+	A65_DEBUG_EXIT_INFO("Result=%u, Line=%u", position, line);
+	return position;
+}
+
 void
 a65_stream::set_metadata(
 	__in const std::string &path
@@ -352,6 +586,26 @@ a65_stream::set_metadata(
 	A65_DEBUG_EXIT();
 }
 
+void
+a65_stream::skip_line(void)
+{
+	A65_DEBUG_ENTRY();
+
+	m_character_position = scan_line(m_character.data(), m_character_position, m_character.size());
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_stream::skip_space(void)
+{
+	A65_DEBUG_ENTRY();
+
+	m_character_position = scan_space(m_character.data(), m_character_position, m_character.size(), m_line);
+
+	A65_DEBUG_EXIT();
+}
+
 std::string
 a65_stream::to_string(void) const
 {
@@ -0,0 +1,346 @@
+/**
+ * A65
+ * Copyright (C) 2018 David Jolly
+ *
+ * A65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/a65_symbol.h"
+#include "../inc/a65_utility.h"
+
+a65_symbol::a65_symbol(void)
+{
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT();
+}
+
+a65_symbol::a65_symbol(
+	__in const a65_symbol &other
+	) :
+		m_entry(other.m_entry),
+		m_index(other.m_index)
+{
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT();
+}
+
+a65_symbol::~a65_symbol(void)
+{
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT();
+}
+
+a65_symbol &
+a65_symbol::operator=(
+	__in const a65_symbol &other
+	)
+{
+	A65_DEBUG_ENTRY();
+
+	if(this != &other) {
+		m_entry = other.m_entry;
+		m_index = other.m_index;
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%p", this);
+	return *this;
+}
+
+void
+a65_symbol::clear(
+	__in int type
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Type=%u(%s)", type, A65_SYMBOL_STRING(type));
+
+	for(std::vector<a65_symbol_entry_t>::iterator entry = m_entry.begin(); entry != m_entry.end(); ++entry) {
+		entry->flag &= ~A65_SYMBOL_FLAG(type);
+	}
+
+	A65_DEBUG_EXIT();
+}
+
+uint32_t
+a65_symbol::compare(
+	__in int type,
+	__in int other
+	) const
+{
+	uint32_t result = A65_SYMBOL_INVALID;
+
+	A65_DEBUG_ENTRY_INFO("Type=%u(%s), Other=%u(%s)", type, A65_SYMBOL_STRING(type), other, A65_SYMBOL_STRING(other));
+
+	for(uint32_t slot = 0; slot < m_entry.size(); ++slot) {
+		const a65_symbol_entry_t &entry = m_entry[slot];
+		bool present = (entry.flag & A65_SYMBOL_FLAG(type));
+
+		if((present != bool(entry.flag & A65_SYMBOL_FLAG(other)))
+				|| (present && (entry.value[type] != entry.value[other]))) {
+			result = slot;
+			break;
+		}
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+bool
+a65_symbol::contains(
+	__in int type,
+	__in uint32_t id
+	) const
+{
+	uint32_t slot;
+	bool result = false;
+
+	A65_DEBUG_ENTRY_INFO("Type=%u(%s), Id=%u(%x)", type, A65_SYMBOL_STRING(type), id, id);
+
+	slot = find(id);
+	if(slot != A65_SYMBOL_INVALID) {
+		result = (m_entry[slot].flag & A65_SYMBOL_FLAG(type));
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%x", result);
+	return result;
+}
+
+void
+a65_symbol::copy(
+	__in int type,
+	__in int other
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Type=%u(%s), Other=%u(%s)", type, A65_SYMBOL_STRING(type), other, A65_SYMBOL_STRING(other));
+
+	for(std::vector<a65_symbol_entry_t>::iterator entry = m_entry.begin(); entry != m_entry.end(); ++entry) {
+		entry->flag &= ~A65_SYMBOL_FLAG(other);
+
+		if(entry->flag & A65_SYMBOL_FLAG(type)) {
+			entry->flag |= A65_SYMBOL_FLAG(other);
+			entry->value[other] = entry->value[type];
+		}
+	}
+
+	A65_DEBUG_EXIT();
+}
+
+const a65_symbol_entry_t &
+a65_symbol::entry(
+	__in uint32_t slot
+	) const
+{
+	const a65_symbol_entry_t *result = nullptr;
+
+	A65_DEBUG_ENTRY_INFO("Slot=%u", slot);
+
+	if(slot >= m_entry.size()) {
+		A65_THROW_EXCEPTION_INFO("Symbol not found", "%u", slot);
+	}
+
+	result = &m_entry[slot];
+
+	A65_DEBUG_EXIT_INFO("Result={%u(%x), %x}", result->id, result->id, result->flag);
+	return *result;
+}
+
+uint32_t
+a65_symbol::find(
+	__in uint32_t id
+	) const
+{
+	uint32_t result = A65_SYMBOL_INVALID;
+
+	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
+
+	if(!m_index.empty()) {
+		size_t mask = (m_index.size() - 1);
+
+		for(size_t position = (A65_SYMBOL_HASH(id) & mask);; position = ((position + 1) & mask)) {
+			uint32_t slot = m_index[position];
+
+			if((slot == A65_SYMBOL_INVALID) || (m_entry[slot].id == id)) {
+				result = slot;
+				break;
+			}
+		}
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+uint32_t
+a65_symbol::insert(
+	__in uint32_t id
+	)
+{
+	uint32_t result;
+
+	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
+
+	result = find(id);
+	if(result == A65_SYMBOL_INVALID) {
+		a65_symbol_entry_t entry = {};
+
+		if((m_entry.size() + 1) > A65_SYMBOL_LOAD_MAX(m_index.size())) {
+			rehash(m_index.empty() ? A65_SYMBOL_CAPACITY_MIN : (m_index.size() * 2));
+		}
+
+		entry.id = id;
+		result = m_entry.size();
+		m_entry.push_back(entry);
+		link(result);
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+void
+a65_symbol::link(
+	__in uint32_t slot
+	)
+{
+	size_t mask, position;
+
+	A65_DEBUG_ENTRY_INFO("Slot=%u", slot);
+
+	mask = (m_index.size() - 1);
+	position = (A65_SYMBOL_HASH(m_entry[slot].id) & mask);
+
+	while(m_index[position] != A65_SYMBOL_INVALID) {
+		position = ((position + 1) & mask);
+	}
+
+	m_index[position] = slot;
+
+	A65_DEBUG_EXIT();
+}
+
+bool
+a65_symbol::match(
+	__in uint32_t slot,
+	__in uint32_t id
+	) const
+{
+	bool result;
+
+	A65_DEBUG_ENTRY_INFO("Slot=%u, Id=%u(%x)", slot, id, id);
+
+	result = ((slot < m_entry.size()) && (m_entry[slot].id == id));
+
+	A65_DEBUG_EXIT_INFO("Result=%x", result);
+	return result;
+}
+
+void
+a65_symbol::rehash(
+	__in size_t capacity
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Capacity=%u", capacity);
+
+	m_index.assign(capacity, A65_SYMBOL_INVALID);
+
+	for(uint32_t slot = 0; slot < m_entry.size(); ++slot) {
+		link(slot);
+	}
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_symbol::remove(
+	__in int type,
+	__in uint32_t slot
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Type=%u(%s), Slot=%u", type, A65_SYMBOL_STRING(type), slot);
+
+	if(slot >= m_entry.size()) {
+		A65_THROW_EXCEPTION_INFO("Symbol not found", "%u", slot);
+	}
+
+	m_entry[slot].flag &= ~A65_SYMBOL_FLAG(type);
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_symbol::set(
+	__in int type,
+	__in uint32_t slot,
+	__in uint16_t value
+	)
+{
+	A65_DEBUG_ENTRY_INFO("Type=%u(%s), Slot=%u, Value=%u(%04x)", type, A65_SYMBOL_STRING(type), slot, value, value);
+
+	if(slot >= m_entry.size()) {
+		A65_THROW_EXCEPTION_INFO("Symbol not found", "%u", slot);
+	}
+
+	m_entry[slot].flag |= A65_SYMBOL_FLAG(type);
+	m_entry[slot].value[type] = value;
+
+	A65_DEBUG_EXIT();
+}
+
+size_t
+a65_symbol::size(void) const
+{
+	size_t result;
+
+	A65_DEBUG_ENTRY();
+
+	result = m_entry.size();
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
+std::string
+a65_symbol::to_string(void) const
+{
+	std::stringstream result;
+
+	A65_DEBUG_ENTRY();
+
+	result << "[" << m_entry.size() << "/" << m_index.size() << "]";
+
+	A65_DEBUG_EXIT();
+	return result.str();
+}
+
+uint16_t
+a65_symbol::value(
+	__in int type,
+	__in uint32_t id
+	) const
+{
+	uint32_t slot;
+	uint16_t result;
+
+	A65_DEBUG_ENTRY_INFO("Type=%u(%s), Id=%u(%x)", type, A65_SYMBOL_STRING(type), id, id);
+
+	slot = find(id);
+	if((slot == A65_SYMBOL_INVALID) || !(m_entry[slot].flag & A65_SYMBOL_FLAG(type))) {
+		A65_THROW_EXCEPTION_INFO("Symbol not found", "%u(%x)", id, id);
+	}
+
+	result = m_entry[slot].value[type];
+
+	A65_DEBUG_EXIT_INFO("Result=%u(%04x)", result, result);
+	return result;
+}
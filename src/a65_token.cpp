@@ -24,7 +24,11 @@ a65_token::a65_token(
 	__in_opt int subtype,
 	__in_opt int mode
 	) :
+		m_column(0),
+		m_file(A65_INTERN_INVALID),
+		m_intern(&a65_intern::instance()),
 		m_line(0),
+		m_literal(A65_INTERN_INVALID),
 		m_mode(mode),
 		m_scalar(0),
 		m_subtype(subtype),
@@ -39,10 +43,12 @@ a65_token::a65_token(
 	__in const a65_token &other
 	) :
 		a65_id(other),
+		m_column(other.m_column),
+		m_file(other.m_file),
+		m_intern(other.m_intern),
 		m_line(other.m_line),
 		m_literal(other.m_literal),
 		m_mode(other.m_mode),
-		m_path(other.m_path),
 		m_scalar(other.m_scalar),
 		m_subtype(other.m_subtype),
 		m_type(other.m_type)
@@ -66,10 +72,12 @@ a65_token::operator=(
 
 	if(this != &other) {
 		a65_id::operator=(other);
+		m_column = other.m_column;
+		m_file = other.m_file;
+		m_intern = other.m_intern;
 		m_line = other.m_line;
 		m_literal = other.m_literal;
 		m_mode = other.m_mode;
-		m_path = other.m_path;
 		m_scalar = other.m_scalar;
 		m_subtype = other.m_subtype;
 		m_type = other.m_type;
@@ -79,6 +87,22 @@ a65_token::operator=(
 	return *this;
 }
 
+size_t
+a65_token::column(void) const
+{
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT_INFO("Result=%u", m_column);
+	return m_column;
+}
+
+uint32_t
+a65_token::file(void) const
+{
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT_INFO("Result=%u(%x)", m_file, m_file);
+	return m_file;
+}
+
 size_t
 a65_token::line(void) const
 {
@@ -87,12 +111,15 @@ a65_token::line(void) const
 	return m_line;
 }
 
-std::string
+const std::string &
 a65_token::literal(void) const
 {
 	A65_DEBUG_ENTRY();
-	A65_DEBUG_EXIT_INFO("Result[%u]=%s", m_literal.size(), A65_STRING_CHECK(m_literal));
-	return m_literal;
+
+	const std::string &result = m_intern->find(m_literal);
+
+	A65_DEBUG_EXIT_INFO("Result[%u]=%s", result.size(), A65_STRING_CHECK(result));
+	return result;
 }
 
 std::string
@@ -102,7 +129,9 @@ a65_token::literal_formatted(void) const
 
 	A65_DEBUG_ENTRY();
 
-	for(std::string::const_iterator ch = m_literal.begin(); ch != m_literal.end(); ++ch) {
+	const std::string &literal = m_intern->find(m_literal);
+
+	for(std::string::const_iterator ch = literal.begin(); ch != literal.end(); ++ch) {
 
 		if(A65_IS_CHARACTER_ESCAPE_VALUE(*ch)) {
 			int type = A65_CHARACTER_ESCAPE_VALUE_ID(*ch);
@@ -158,12 +187,15 @@ a65_token::mode(void) const
 	return m_mode;
 }
 
-std::string
+const std::string &
 a65_token::path(void) const
 {
 	A65_DEBUG_ENTRY();
-	A65_DEBUG_EXIT_INFO("Result[%u]=%s", m_path.size(), A65_STRING_CHECK(m_path));
-	return m_path;
+
+	const std::string &result = m_intern->find(m_file);
+
+	A65_DEBUG_EXIT_INFO("Result[%u]=%s", result.size(), A65_STRING_CHECK(result));
+	return result;
 }
 
 uint16_t
@@ -198,7 +230,23 @@ a65_token::set_literal(
 {
 	A65_DEBUG_ENTRY_INFO("Literal[%u]=%s", literal.size(), A65_STRING_CHECK(literal));
 
-	m_literal = literal;
+	m_literal = m_intern->generate(literal);
+
+	A65_DEBUG_EXIT();
+}
+
+void
+a65_token::set_location(
+	__in uint32_t file,
+	__in size_t line,
+	__in size_t column
+	)
+{
+	A65_DEBUG_ENTRY_INFO("File=%u(%x), Line=%u, Column=%u", file, file, line, column);
+
+	m_column = column;
+	m_file = file;
+	m_line = line;
 
 	A65_DEBUG_EXIT();
 }
@@ -210,7 +258,7 @@ a65_token::set_metadata(
 {
 	A65_DEBUG_ENTRY_INFO("Path[%u]=%s", path.size(), A65_STRING_CHECK(path));
 
-	m_path = path;
+	m_file = m_intern->generate(path);
 
 	A65_DEBUG_EXIT();
 }
@@ -223,8 +271,8 @@ a65_token::set_metadata(
 {
 	A65_DEBUG_ENTRY_INFO("Path[%u]=%s, Line=%u", path.size(), A65_STRING_CHECK(path), line);
 
+	m_file = m_intern->generate(path);
 	m_line = line;
-	m_path = path;
 
 	A65_DEBUG_EXIT();
 }
@@ -261,6 +309,14 @@ a65_token::subtype(void) const
 	return m_subtype;
 }
 
+uint32_t
+a65_token::symbol(void) const
+{
+	A65_DEBUG_ENTRY();
+	A65_DEBUG_EXIT_INFO("Result=%u(%x)", m_literal, m_literal);
+	return m_literal;
+}
+
 std::string
 a65_token::to_string(void) const
 {
@@ -282,13 +338,13 @@ a65_token::to_string(void) const
 				case A65_TOKEN_IDENTIFIER:
 				case A65_TOKEN_LABEL:
 #ifndef NDEBUG
-					result << "[" << m_literal.size() << "] ";
+					result << "[" << literal().size() << "] ";
 #endif // NDEBUG
-					result << "\"" << A65_STRING_CHECK(m_literal) << "\"";
+					result << "\"" << A65_STRING_CHECK(literal()) << "\"";
 					break;
 				case A65_TOKEN_LITERAL:
 #ifndef NDEBUG
-					result << "[" << m_literal.size() << "] ";
+					result << "[" << literal().size() << "] ";
 #endif // NDEBUG
 					result << "\"" << literal_formatted() << "\"";
 					break;
@@ -338,8 +394,8 @@ a65_token::to_string(void) const
 
 			result << " (";
 
-			if(!m_path.empty()) {
-				result << A65_STRING_CHECK(m_path) << ":";
+			if(!path().empty()) {
+				result << A65_STRING_CHECK(path()) << ":";
 			}
 
 			result << m_line << ")";
@@ -22,8 +22,9 @@
 a65_tree::a65_tree(
 	__in_opt int type
 	) :
-		m_node(A65_UUID_INVALID),
-		m_node_root(A65_UUID_INVALID),
+		m_node(A65_NODE_INVALID),
+		m_node_count(0),
+		m_node_root(A65_NODE_INVALID),
 		m_type(type)
 {
 	A65_DEBUG_ENTRY_INFO("Type=%u(%s)", type, A65_TREE_STRING(type));
@@ -35,7 +36,9 @@ a65_tree::a65_tree(
 	) :
 		a65_id(other),
 		m_node(other.m_node),
-		m_node_map(other.m_node_map),
+		m_node_child(other.m_node_child),
+		m_node_count(other.m_node_count),
+		m_node_pool(other.m_node_pool),
 		m_node_root(other.m_node_root),
 		m_type(other.m_type)
 {
@@ -59,7 +62,9 @@ a65_tree::operator=(
 	if(this != &other) {
 		a65_id::operator=(other);
 		m_node = other.m_node;
-		m_node_map = other.m_node_map;
+		m_node_child = other.m_node_child;
+		m_node_count = other.m_node_count;
+		m_node_pool = other.m_node_pool;
 		m_node_root = other.m_node_root;
 		m_type = other.m_type;
 	}
@@ -80,15 +85,14 @@ a65_tree::add_child(
 
 	A65_DEBUG_ENTRY_INFO("Type=%u(%s), Token=%u(%x), Position=%u", type, A65_NODE_STRING(type), token, token, position);
 
-	if(m_node == A65_UUID_INVALID) {
+	if(m_node == A65_NODE_INVALID) {
 		A65_THROW_EXCEPTION_INFO("Parent node undefined", "%u(%x)", token, token);
 	}
 
-	a65_node node(type, token, m_node);
-
-	id = node.id();
-	m_node_map.insert(std::make_pair(id, node));
-	result = find(m_node)->second.add_child(id, position);
+	id = m_node_pool.size();
+	m_node_pool.push_back(a65_node(type, token, m_node));
+	result = insert(m_node, id, position);
+	++m_node_count;
 
 	A65_DEBUG_EXIT_INFO("Result=%u", result);
 	return result;
@@ -104,20 +108,38 @@ a65_tree::add_root(
 
 	A65_DEBUG_ENTRY_INFO("Type=%u(%s), Token=%u(%x)", type, A65_NODE_STRING(type), token, token);
 
-	if(m_node_root != A65_UUID_INVALID) {
+	if(m_node_root != A65_NODE_INVALID) {
 		A65_THROW_EXCEPTION_INFO("Root node redefined", "%u(%x)", token, token);
 	}
 
-	a65_node node(type, token);
-
-	id = node.id();
-	m_node_map.insert(std::make_pair(id, node));
+	id = m_node_pool.size();
+	m_node_pool.push_back(a65_node(type, token));
+	++m_node_count;
 	m_node = id;
 	m_node_root = id;
 
 	A65_DEBUG_EXIT();
 }
 
+size_t
+a65_tree::count(
+	__in uint32_t id
+	) const
+{
+	size_t child, result = 1;
+
+	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
+
+	const a65_node &entry = m_node_pool.at(id);
+
+	for(child = 0; child < entry.child_count(); ++child) {
+		result += count(m_node_child.at(entry.child() + child));
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
 bool
 a65_tree::empty(void) const
 {
@@ -125,28 +147,25 @@ a65_tree::empty(void) const
 
 	A65_DEBUG_ENTRY();
 
-	result = (m_node_root == A65_UUID_INVALID);
+	result = (m_node_root == A65_NODE_INVALID);
 
 	A65_DEBUG_EXIT_INFO("Result=%x", result);
 	return result;
 }
 
-std::map<uint32_t, a65_node>::iterator
+a65_node &
 a65_tree::find(
 	__in uint32_t id
 	)
 {
-	std::map<uint32_t, a65_node>::iterator result;
-
 	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
 
-	result = m_node_map.find(id);
-	if(result == m_node_map.end()) {
+	if(id >= m_node_pool.size()) {
 		A65_THROW_EXCEPTION_INFO("Node not found", "%u(%x)", id, id);
 	}
 
-	A65_DEBUG_EXIT_INFO("Result={%u(%x), %s}", result->first, result->first, A65_STRING_CHECK(result->second.to_string()));
-	return result;
+	A65_DEBUG_EXIT_INFO("Result=%s", A65_STRING_CHECK(m_node_pool[id].to_string()));
+	return m_node_pool[id];
 }
 
 bool
@@ -158,14 +177,9 @@ a65_tree::has_child(
 
 	A65_DEBUG_ENTRY_INFO("Position=%u", position);
 
-	result = (m_node != A65_UUID_INVALID);
+	result = (m_node < m_node_pool.size());
 	if(result) {
-		std::map<uint32_t, a65_node>::const_iterator entry = m_node_map.find(m_node);
-
-		result = (entry != m_node_map.end());
-		if(result) {
-			result = entry->second.has_child(position);
-		}
+		result = m_node_pool[m_node].has_child(position);
 	}
 
 	A65_DEBUG_EXIT_INFO("Result=%x", result);
@@ -179,14 +193,9 @@ a65_tree::has_parent(void) const
 
 	A65_DEBUG_ENTRY();
 
-	result = (m_node != A65_UUID_INVALID);
+	result = (m_node < m_node_pool.size());
 	if(result) {
-		std::map<uint32_t, a65_node>::const_iterator entry = m_node_map.find(m_node);
-
-		result = (entry != m_node_map.end());
-		if(result) {
-			result = entry->second.has_parent();
-		}
+		result = m_node_pool[m_node].has_parent();
 	}
 
 	A65_DEBUG_EXIT_INFO("Result=%x", result);
@@ -200,15 +209,54 @@ a65_tree::has_root(void) const
 
 	A65_DEBUG_ENTRY();
 
-	result = (m_node_root != A65_UUID_INVALID);
-	if(result) {
-		result = (m_node_map.find(m_node_root) != m_node_map.end());
-	}
+	result = (m_node_root < m_node_pool.size());
 
 	A65_DEBUG_EXIT_INFO("Result=%x", result);
 	return result;
 }
 
+size_t
+a65_tree::insert(
+	__in uint32_t parent,
+	__in uint32_t id,
+	__in size_t position
+	)
+{
+	size_t child, length, offset, result;
+
+	A65_DEBUG_ENTRY_INFO("Parent=%u(%x), Id=%u(%x), Position=%u", parent, parent, id, id, position);
+
+	a65_node &entry = find(parent);
+
+	length = entry.child_count();
+	offset = entry.child();
+
+	result = position;
+	if(result == (size_t) A65_NODE_POSITION_UNDEFINED) {
+		result = length;
+	}
+
+	if(result > length) {
+		A65_THROW_EXCEPTION_INFO("Node child position too large", "%u (max=%u)", result, length);
+	}
+
+	if((offset + length) != m_node_child.size()) {
+		m_node_child.reserve(m_node_child.size() + length + 1);
+
+		for(child = 0; child < length; ++child) {
+			m_node_child.push_back(m_node_child[offset + child]);
+		}
+
+		offset = (m_node_child.size() - length);
+	}
+
+	m_node_child.insert(m_node_child.begin() + offset + result, id);
+	entry.set_child(offset, length + 1);
+
+	A65_DEBUG_EXIT_INFO("Result=%u", result);
+	return result;
+}
+
 bool
 a65_tree::match(
 	__in int type
@@ -235,7 +283,7 @@ a65_tree::move_child(
 		A65_THROW_EXCEPTION_INFO("Node child position out-of-range", "%u", position);
 	}
 
-	m_node = find(m_node)->second.child(position);
+	m_node = m_node_child[m_node_pool[m_node].child() + position];
 
 	A65_DEBUG_EXIT();
 }
@@ -266,7 +314,7 @@ a65_tree::move_parent(void)
 		A65_THROW_EXCEPTION_INFO("No parent node found", "%u(%x)", m_node, m_node);
 	}
 
-	m_node = find(m_node)->second.parent();
+	m_node = m_node_pool[m_node].parent();
 
 	A65_DEBUG_EXIT();
 }
@@ -304,63 +352,46 @@ a65_tree::node(
 	__in_opt uint32_t id
 	)
 {
-	std::map<uint32_t, a65_node>::iterator result;
-
 	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
 
-	if(id == A65_UUID_INVALID) {
+	if(id == A65_NODE_INVALID) {
 		id = m_node;
 	}
 
-	if(id == A65_UUID_INVALID) {
+	if(id == A65_NODE_INVALID) {
 		A65_THROW_EXCEPTION("Tree is empty");
 	}
 
-	result = find(id);
+	a65_node &result = find(id);
 
-	A65_DEBUG_EXIT_INFO("Result=%s", A65_STRING_CHECK(result->second.to_string()));
-	return result->second;
+	A65_DEBUG_EXIT_INFO("Result=%s", A65_STRING_CHECK(result.to_string()));
+	return result;
 }
 
 void
-a65_tree::remove(void)
+a65_tree::remove_child(
+	__in size_t position
+	)
 {
-	size_t child;
-	a65_node parent;
+	size_t child, length, offset;
 
-	A65_DEBUG_ENTRY();
-
-	parent = node();
+	A65_DEBUG_ENTRY_INFO("Position=%u", position);
 
-	for(child = 0; child < parent.child_count(); ++child) {
-		move_child(child);
-		remove();
+	if(!has_child(position)) {
+		A65_THROW_EXCEPTION_INFO("Node child position out-of-range", "%u", position);
 	}
 
-	parent.remove_all_children();
+	a65_node &entry = find(m_node);
 
-	if(parent.has_parent()) {
-		move_parent();
-	} else {
-		m_node = A65_UUID_INVALID;
-		m_node_root = A65_UUID_INVALID;
-	}
-
-	m_node_map.erase(find(parent.id()));
+	length = entry.child_count();
+	offset = entry.child();
+	m_node_count -= count(m_node_child[offset + position]);
 
-	A65_DEBUG_EXIT();
-}
-
-void
-a65_tree::remove_child(
-	__in size_t position
-	)
-{
-	A65_DEBUG_ENTRY_INFO("Position=%u", position);
+	for(child = (position + 1); child < length; ++child) {
+		m_node_child[offset + child - 1] = m_node_child[offset + child];
+	}
 
-	move_child(position);
-	remove();
-	node().remove_child(position);
+	entry.set_child(offset, length - 1);
 
 	A65_DEBUG_EXIT();
 }
@@ -370,9 +401,11 @@ a65_tree::remove_root(void)
 {
 	A65_DEBUG_ENTRY();
 
-	m_node = A65_UUID_INVALID;
-	m_node_map.clear();
-	m_node_root = A65_UUID_INVALID;
+	m_node = A65_NODE_INVALID;
+	m_node_child.clear();
+	m_node_count = 0;
+	m_node_pool.clear();
+	m_node_root = A65_NODE_INVALID;
 
 	A65_DEBUG_EXIT();
 }
@@ -400,7 +433,7 @@ a65_tree::to_string(void) const
 #ifndef NDEBUG
 		<< "{" << a65_id::to_string() << "} "
 #endif // NDEBUG
-		<< "[" << A65_TREE_STRING(m_type) << "] <" << m_node_map.size() << ">";
+		<< "[" << A65_TREE_STRING(m_type) << "] <" << m_node_count << ">";
 
 	if(has_root()) {
 		result << " {" << A65_STRING_HEX(uint32_t, m_node_root) << ", " << A65_STRING_HEX(uint32_t, m_node) << "}";
@@ -18,6 +18,23 @@
 
 #include "../inc/a65_utility.h"
 
+void
+a65_utility::copy_file(
+	__in const std::string &source,
+	__in const std::string &destination
+	)
+{
+	std::vector<uint8_t> data;
+
+	A65_DEBUG_ENTRY_INFO("Source[%u]=%s, Destination[%u]=%s", source.size(), A65_STRING_CHECK(source),
+		destination.size(), A65_STRING_CHECK(destination));
+
+	read_file(source, data);
+	write_file(destination, data);
+
+	A65_DEBUG_EXIT();
+}
+
 std::string
 a65_utility::data_as_string(
 	__in const std::vector<uint8_t> &data,
@@ -180,6 +197,92 @@ a65_utility::decompose_file_path(
 	return result;
 }
 
+bool
+a65_utility::has_file(
+	__in const std::string &path
+	)
+{
+	bool result = false;
+
+	A65_DEBUG_ENTRY_INFO("Path[%u]=%s", path.size(), A65_STRING_CHECK(path));
+
+	if(!path.empty()) {
+		std::ifstream file(path.c_str(), std::ios::binary | std::ios::in);
+
+		result = file.good();
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%x", result);
+	return result;
+}
+
+uint64_t
+a65_utility::hash(
+	__in const std::string &data,
+	__in_opt uint64_t seed
+	)
+{
+	uint32_t word;
+	uint64_t input, result;
+	size_t length, position = 0;
+	const uint8_t *buffer = (const uint8_t *)data.data();
+
+	A65_DEBUG_ENTRY_INFO("Data[%u]=%p, Seed=%llx", data.size(), &data, seed);
+
+	length = data.size();
+
+	if(length >= A65_HASH_STRIPE_LENGTH) {
+		uint64_t accumulator[] = { seed + A65_HASH_PRIME_1 + A65_HASH_PRIME_2, seed + A65_HASH_PRIME_2, seed,
+			seed - A65_HASH_PRIME_1 };
+
+		for(; (position + A65_HASH_STRIPE_LENGTH) <= length; position += A65_HASH_STRIPE_LENGTH) {
+
+			for(size_t lane = 0; lane < 4; ++lane) {
+				std::memcpy(&input, buffer + position + (lane * sizeof(input)), sizeof(input));
+				accumulator[lane] = A65_HASH_ROUND(accumulator[lane], input);
+			}
+		}
+
+		result = A65_HASH_ROTATE(accumulator[0], 1) + A65_HASH_ROTATE(accumulator[1], 7)
+			+ A65_HASH_ROTATE(accumulator[2], 12) + A65_HASH_ROTATE(accumulator[3], 18);
+
+		for(size_t lane = 0; lane < 4; ++lane) {
+			result = A65_HASH_MERGE(result, accumulator[lane]);
+		}
+	} else {
+		result = seed + A65_HASH_PRIME_5;
+	}
+
+	result += length;
+
+	for(; (position + sizeof(input)) <= length; position += sizeof(input)) {
+		std::memcpy(&input, buffer + position, sizeof(input));
+		result ^= A65_HASH_ROUND(0, input);
+		result = (A65_HASH_ROTATE(result, 27) * A65_HASH_PRIME_1) + A65_HASH_PRIME_4;
+	}
+
+	if((position + sizeof(word)) <= length) {
+		std::memcpy(&word, buffer + position, sizeof(word));
+		result ^= (uint64_t)word * A65_HASH_PRIME_1;
+		result = (A65_HASH_ROTATE(result, 23) * A65_HASH_PRIME_2) + A65_HASH_PRIME_3;
+		position += sizeof(word);
+	}
+
+	for(; position < length; ++position) {
+		result ^= buffer[position] * A65_HASH_PRIME_5;
+		result = A65_HASH_ROTATE(result, 11) * A65_HASH_PRIME_1;
+	}
+
+	result ^= (result >> 33);
+	result *= A65_HASH_PRIME_2;
+	result ^= (result >> 29);
+	result *= A65_HASH_PRIME_3;
+	result ^= (result >> 32);
+
+	A65_DEBUG_EXIT_INFO("Result=%llx", result);
+	return result;
+}
+
 size_t
 a65_utility::read_file(
 	__in const std::string &path,
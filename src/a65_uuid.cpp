@@ -19,25 +19,58 @@
 #include "../inc/a65_utility.h"
 #include "../inc/a65_uuid.h"
 
+static thread_local a65_uuid *g_context = nullptr;
+
 a65_uuid::a65_uuid(void) :
-	m_next(A65_UUID_INVALID + 1)
+	m_next(A65_UUID_INVALID + 1),
+	m_surplus(A65_UUID_SURPLUS(0, A65_UUID_INVALID))
 {
 	A65_DEBUG_ENTRY();
+
+	for(size_t index = 0; index < A65_UUID_PAGE_COUNT; ++index) {
+		m_page[index].store(nullptr, std::memory_order_relaxed);
+	}
+
 	A65_DEBUG_EXIT();
 }
 
 a65_uuid::~a65_uuid(void)
 {
 	A65_DEBUG_ENTRY();
+
+	for(size_t index = 0; index < A65_UUID_PAGE_COUNT; ++index) {
+		a65_uuid_page_t *entry = m_page[index].exchange(nullptr);
+
+		if(entry) {
+			delete entry;
+		}
+	}
+
 	A65_DEBUG_EXIT();
 }
 
+a65_uuid *
+a65_uuid::bind(
+	__in_opt a65_uuid *context
+	)
+{
+	a65_uuid *result;
+
+	A65_DEBUG_ENTRY_INFO("Context=%p", context);
+
+	result = g_context;
+	g_context = context;
+
+	A65_DEBUG_EXIT_INFO("Result=%p", result);
+	return result;
+}
+
 bool
 a65_uuid::contains(
 	__in uint32_t id
 	) const
 {
-	bool result;
+	bool result = false;
 
 	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
 
@@ -45,7 +78,13 @@ a65_uuid::contains(
 		A65_THROW_EXCEPTION_INFO("Invalid uuid", "%u(%x)", id, id);
 	}
 
-	result = (m_reference.find(id) != m_reference.end());
+	if(id <= A65_UUID_MAX) {
+		a65_uuid_page_t *entry = m_page[A65_UUID_PAGE(id)].load(std::memory_order_acquire);
+
+		if(entry) {
+			result = (entry->reference[A65_UUID_PAGE_OFFSET(id)].load(std::memory_order_acquire) >= A65_UUID_REFERENCE_START);
+		}
+	}
 
 	A65_DEBUG_EXIT_INFO("Result=%x", result);
 	return result;
@@ -56,58 +95,75 @@ a65_uuid::decrement(
 	__in uint32_t id
 	)
 {
-	std::map<uint32_t, size_t>::iterator entry;
+	uint64_t surplus;
+	a65_uuid_page_t *entry;
 
 	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
 
-	entry = find(id);
-	if(entry->second <= A65_UUID_REFERENCE_START) {
-		m_surplus.insert(entry->first);
-		m_reference.erase(entry);
-	} else {
-		--entry->second;
+	if(find(id).fetch_sub(1, std::memory_order_acq_rel) == A65_UUID_REFERENCE_START) {
+		entry = page(id);
+		surplus = m_surplus.load(std::memory_order_relaxed);
+
+		do {
+			entry->surplus[A65_UUID_PAGE_OFFSET(id)].store(A65_UUID_SURPLUS_ID(surplus), std::memory_order_relaxed);
+		} while(!m_surplus.compare_exchange_weak(surplus, A65_UUID_SURPLUS(A65_UUID_SURPLUS_TAG(surplus) + 1, id),
+				std::memory_order_release, std::memory_order_relaxed));
 	}
 
 	A65_DEBUG_EXIT();
 }
 
-std::map<uint32_t, size_t>::iterator
+std::atomic<uint32_t> &
 a65_uuid::find(
 	__in uint32_t id
-	)
+	) const
 {
-	std::map<uint32_t, size_t>::iterator result;
+	a65_uuid_page_t *entry = nullptr;
 
 	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
 
-	result = m_reference.find(id);
-	if(result == m_reference.end()) {
+	if((id != A65_UUID_INVALID) && (id <= A65_UUID_MAX)) {
+		entry = m_page[A65_UUID_PAGE(id)].load(std::memory_order_acquire);
+	}
+
+	if(!entry || (entry->reference[A65_UUID_PAGE_OFFSET(id)].load(std::memory_order_acquire) < A65_UUID_REFERENCE_START)) {
 		A65_THROW_EXCEPTION_INFO("Uuid not found", "%u(%x)", id, id);
 	}
 
-	A65_DEBUG_EXIT_INFO("Result={%u(%x), %u}", result->first, result->first, result->second);
-	return result;
+	A65_DEBUG_EXIT_INFO("Result=%p", &entry->reference[A65_UUID_PAGE_OFFSET(id)]);
+	return entry->reference[A65_UUID_PAGE_OFFSET(id)];
 }
 
 uint32_t
 a65_uuid::generate(void)
 {
+	uint64_t surplus;
 	uint32_t result = A65_UUID_INVALID;
 
 	A65_DEBUG_ENTRY();
 
-	if(!m_surplus.empty()) {
-		std::set<uint32_t>::iterator entry = m_surplus.begin();
+	surplus = m_surplus.load(std::memory_order_acquire);
+
+	while(A65_UUID_SURPLUS_ID(surplus) != A65_UUID_INVALID) {
+		uint32_t next = page(A65_UUID_SURPLUS_ID(surplus))->surplus[A65_UUID_PAGE_OFFSET(A65_UUID_SURPLUS_ID(surplus))].load(
+			std::memory_order_relaxed);
 
-		result = *entry;
-		m_surplus.erase(entry);
-	} else if(m_next != A65_UUID_INVALID) {
-		result = m_next++;
-	} else {
-		A65_THROW_EXCEPTION("No avaliable uuid");
+		if(m_surplus.compare_exchange_weak(surplus, A65_UUID_SURPLUS(A65_UUID_SURPLUS_TAG(surplus) + 1, next),
+				std::memory_order_acq_rel, std::memory_order_acquire)) {
+			result = A65_UUID_SURPLUS_ID(surplus);
+			break;
+		}
 	}
 
-	m_reference.insert(std::make_pair(result, A65_UUID_REFERENCE_START));
+	if(result == A65_UUID_INVALID) {
+
+		result = m_next.fetch_add(1, std::memory_order_relaxed);
+		if((result == A65_UUID_INVALID) || (result > A65_UUID_MAX)) {
+			A65_THROW_EXCEPTION("No avaliable uuid");
+		}
+	}
+
+	page(result)->reference[A65_UUID_PAGE_OFFSET(result)].store(A65_UUID_REFERENCE_START, std::memory_order_release);
 
 	A65_DEBUG_EXIT_INFO("Result=%u(%x)", result, result);
 	return result;
@@ -120,7 +176,7 @@ a65_uuid::increment(
 {
 	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
 
-	++find(id)->second;
+	find(id).fetch_add(1, std::memory_order_relaxed);
 
 	A65_DEBUG_EXIT();
 }
@@ -132,6 +188,33 @@ a65_uuid::instance(void)
 
 	static a65_uuid result;
 
-	A65_DEBUG_EXIT_INFO("Result=%p", &result);
+	a65_uuid &context = (g_context ? *g_context : result);
+
+	A65_DEBUG_EXIT_INFO("Result=%p", &context);
+	return context;
+}
+
+a65_uuid_page_t *
+a65_uuid::page(
+	__in uint32_t id
+	)
+{
+	a65_uuid_page_t *result;
+	std::atomic<a65_uuid_page_t *> &entry = m_page[A65_UUID_PAGE(id)];
+
+	A65_DEBUG_ENTRY_INFO("Id=%u(%x)", id, id);
+
+	result = entry.load(std::memory_order_acquire);
+	if(!result) {
+		a65_uuid_page_t *allocated = new a65_uuid_page_t();
+
+		if(entry.compare_exchange_strong(result, allocated, std::memory_order_acq_rel, std::memory_order_acquire)) {
+			result = allocated;
+		} else {
+			delete allocated;
+		}
+	}
+
+	A65_DEBUG_EXIT_INFO("Result=%p", result);
 	return result;
 }
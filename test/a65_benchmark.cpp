@@ -0,0 +1,452 @@
+/**
+ * A65
+ * Copyright (C) 2018 David Jolly
+ *
+ * A65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "./a65_benchmark_type.h"
+
+static std::atomic<size_t> g_allocation(0);
+
+void *
+operator new(
+	__in size_t size
+	)
+{
+	void *result;
+
+	++g_allocation;
+
+	result = std::malloc(size ? size : 1);
+	if(!result) {
+		throw std::bad_alloc();
+	}
+
+	return result;
+}
+
+void
+operator delete(
+	__in void *pointer
+	) noexcept
+{
+	std::free(pointer);
+}
+
+void
+operator delete(
+	__in void *pointer,
+	__in size_t size
+	) noexcept
+{
+	std::free(pointer);
+}
+
+class a65_benchmark_assembler :
+		public a65_assembler {
+
+	public:
+
+		explicit a65_benchmark_assembler(
+			__in const std::string &input
+			)
+		{
+			a65_parser::load(input, false);
+			a65_assembler::clear();
+			preprocess_tree();
+		}
+
+		void run(
+			__in bool second_pass
+			)
+		{
+			m_second_pass = second_pass;
+			a65_assembler::clear();
+			evaluate(*this);
+		}
+};
+
+class a65_benchmark_expression :
+		public a65_assembler {
+
+	public:
+
+		explicit a65_benchmark_expression(
+			__in const std::string &input
+			)
+		{
+			a65_parser::load(input, false);
+			a65_assembler::clear();
+			preprocess_tree();
+			m_second_pass = false;
+			evaluate(*this);
+			m_second_pass = true;
+			a65_parser::reset();
+
+			while(a65_parser::has_next()) {
+				a65_tree &tree = a65_parser::tree_ref();
+
+				if(tree.node().match(A65_NODE_DIRECTIVE) && tree.node().has_child(0)) {
+					a65_tree::move_child(tree, 0);
+
+					if(tree.node().match(A65_NODE_LIST)) {
+						m_list.push_back(&tree);
+					}
+
+					a65_tree::move_parent(tree);
+				}
+
+				a65_parser::move_next();
+			}
+		}
+
+		size_t run(
+			__in bool compile
+			)
+		{
+			size_t result = 0;
+
+			if(compile) {
+				clear_expression();
+			}
+
+			for(std::vector<a65_tree *>::iterator entry = m_list.begin(); entry != m_list.end(); ++entry) {
+				a65_tree &tree = **entry;
+
+				a65_tree::move_child(tree, 0);
+
+				for(size_t child = 0; child < tree.node().child_count(); ++child) {
+					a65_tree::move_child(tree, child);
+					evaluate_expression(*this, tree);
+					a65_tree::move_parent(tree);
+					++result;
+				}
+
+				a65_tree::move_parent(tree);
+			}
+
+			return result;
+		}
+
+	protected:
+
+		std::vector<a65_tree *> m_list;
+};
+
+class a65_benchmark_uuid_legacy {
+
+	public:
+
+		a65_benchmark_uuid_legacy(void) :
+			m_next(A65_UUID_INVALID + 1)
+		{
+			return;
+		}
+
+		void decrement(
+			__in uint32_t id
+			)
+		{
+			std::map<uint32_t, size_t>::iterator entry = m_reference.find(id);
+
+			if(entry->second <= A65_UUID_REFERENCE_START) {
+				m_surplus.insert(entry->first);
+				m_reference.erase(entry);
+			} else {
+				--entry->second;
+			}
+		}
+
+		uint32_t generate(void)
+		{
+			uint32_t result;
+
+			if(!m_surplus.empty()) {
+				std::set<uint32_t>::iterator entry = m_surplus.begin();
+
+				result = *entry;
+				m_surplus.erase(entry);
+			} else {
+				result = m_next++;
+			}
+
+			m_reference.insert(std::make_pair(result, A65_UUID_REFERENCE_START));
+
+			return result;
+		}
+
+		void increment(
+			__in uint32_t id
+			)
+		{
+			++m_reference.find(id)->second;
+		}
+
+	protected:
+
+		uint32_t m_next;
+
+		std::map<uint32_t, size_t> m_reference;
+
+		std::set<uint32_t> m_surplus;
+};
+
+template <class T> void
+run_uuid_workload(
+	__in T &uuid
+	)
+{
+	std::vector<uint32_t> id(A65_BENCHMARK_UUID_COUNT);
+
+	for(size_t pass = 0; pass < 2; ++pass) {
+
+		for(size_t index = 0; index < id.size(); ++index) {
+			id.at(index) = uuid.generate();
+
+			for(size_t copy = 0; copy < A65_BENCHMARK_UUID_COPY; ++copy) {
+				uuid.increment(id.at(index));
+			}
+		}
+
+		for(size_t index = 0; index < id.size(); ++index) {
+
+			for(size_t copy = 0; copy <= A65_BENCHMARK_UUID_COPY; ++copy) {
+				uuid.decrement(id.at(index));
+			}
+		}
+	}
+}
+
+double
+run_uuid_benchmark(
+	__in int benchmark
+	)
+{
+	size_t thread_count = 1;
+	std::chrono::high_resolution_clock::time_point begin;
+
+	begin = std::chrono::high_resolution_clock::now();
+
+	switch(benchmark) {
+		case A65_BENCHMARK_UUID_LEGACY: {
+				a65_benchmark_uuid_legacy uuid;
+
+				run_uuid_workload(uuid);
+			} break;
+		case A65_BENCHMARK_UUID_CONTEXT: {
+				a65_uuid uuid;
+
+				run_uuid_workload(uuid);
+			} break;
+		case A65_BENCHMARK_UUID_CONTEXT_THREADED: {
+				a65_uuid uuid;
+				std::vector<std::thread> thread;
+
+				thread_count = A65_BENCHMARK_UUID_THREAD;
+
+				for(size_t index = 0; index < thread_count; ++index) {
+					thread.push_back(std::thread([&uuid]() { run_uuid_workload(uuid); }));
+				}
+
+				for(std::vector<std::thread>::iterator entry = thread.begin(); entry != thread.end(); ++entry) {
+					entry->join();
+				}
+			} break;
+		default:
+			break;
+	}
+
+	return (std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - begin).count()
+		/ (thread_count * 2 * A65_BENCHMARK_UUID_COUNT * ((A65_BENCHMARK_UUID_COPY * 2) + 2)));
+}
+
+int
+run_uuid_benchmarks(void)
+{
+	int result = EXIT_SUCCESS;
+
+	for(int benchmark = A65_BENCHMARK_UUID_MIN; benchmark <= A65_BENCHMARK_UUID_MAX; ++benchmark) {
+		std::cout << A65_COLUMN_WIDTH(A65_BENCHMARK_COLUMN_WIDTH) << A65_BENCHMARK_STRING(benchmark)
+			<< A65_FLOAT_PREC(A65_BENCHMARK_PRECISION, run_uuid_benchmark(benchmark)) << " ns/op" << std::endl;
+	}
+
+	return result;
+}
+
+std::string
+form_assembler_source(void)
+{
+	std::stringstream result;
+
+	result << "\t.def zp 0x10" << std::endl << "\t.org 0x0200" << std::endl;
+
+	for(size_t index = 0; index < A65_BENCHMARK_ASSEMBLER_STATEMENT; ++index) {
+		result << "l" << index << ":" << std::endl
+			<< "\tlda #low(l" << index << ") + " << (index % 7) << std::endl
+			<< "\tsta 0x0200 + (" << index << " & 0xff)" << std::endl
+			<< "\tldx zp" << std::endl
+			<< "\t.db \"ab\", " << (index & UINT8_MAX) << ", (1 << 3) | 2" << std::endl
+			<< "\t.dw l" << index << ", high(l" << index << ")" << std::endl
+			<< "\tbne l" << index << std::endl;
+	}
+
+	return result.str();
+}
+
+int
+run_assembler_benchmarks(void)
+{
+	int result = EXIT_SUCCESS;
+	a65_benchmark_assembler assembler(form_assembler_source());
+
+	assembler.run(false);
+
+	for(int benchmark = A65_BENCHMARK_ASSEMBLER_MIN; benchmark <= A65_BENCHMARK_ASSEMBLER_MAX; ++benchmark) {
+		double duration;
+		size_t allocation;
+		std::chrono::high_resolution_clock::time_point begin;
+
+		allocation = g_allocation;
+		begin = std::chrono::high_resolution_clock::now();
+
+		for(size_t iteration = 0; iteration < A65_BENCHMARK_ASSEMBLER_ITERATION; ++iteration) {
+			assembler.run(benchmark == A65_BENCHMARK_ASSEMBLER_PASS_SECOND);
+		}
+
+		duration = std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - begin).count();
+		allocation = (g_allocation - allocation);
+
+		std::cout << A65_COLUMN_WIDTH(A65_BENCHMARK_COLUMN_WIDTH) << A65_BENCHMARK_STRING(benchmark)
+			<< A65_FLOAT_PREC(A65_BENCHMARK_PRECISION, duration / A65_BENCHMARK_ASSEMBLER_ITERATION)
+			<< " us/pass, " << (allocation / A65_BENCHMARK_ASSEMBLER_ITERATION) << " allocs/pass"
+			<< std::endl;
+	}
+
+	return result;
+}
+
+std::string
+form_expression_source(void)
+{
+	std::stringstream result;
+
+	result << "\t.def zp 0x10" << std::endl << "\t.org 0x0200" << std::endl;
+
+	for(size_t index = 0; index < A65_BENCHMARK_ASSEMBLER_STATEMENT; ++index) {
+		result << "l" << index << ":" << std::endl
+			<< "\t.dw (l" << index << " + " << (index % 7) << ") * 3 - high(zp << 2), low(l" << index << ") | zp ^ "
+				<< (index & UINT8_MAX) << ", \"ab\" {l" << index << " & 1}" << std::endl;
+	}
+
+	return result.str();
+}
+
+int
+run_expression_benchmarks(void)
+{
+	int result = EXIT_SUCCESS;
+	a65_benchmark_expression expression(form_expression_source());
+
+	for(int benchmark = A65_BENCHMARK_EXPRESSION_MIN; benchmark <= A65_BENCHMARK_EXPRESSION_MAX; ++benchmark) {
+		double duration;
+		size_t count = 0;
+		std::chrono::high_resolution_clock::time_point begin;
+
+		begin = std::chrono::high_resolution_clock::now();
+
+		for(size_t iteration = 0; iteration < A65_BENCHMARK_EXPRESSION_ITERATION; ++iteration) {
+			count += expression.run(benchmark == A65_BENCHMARK_EXPRESSION_COMPILE);
+		}
+
+		duration = std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - begin).count();
+
+		std::cout << A65_COLUMN_WIDTH(A65_BENCHMARK_COLUMN_WIDTH) << A65_BENCHMARK_STRING(benchmark)
+			<< A65_FLOAT_PREC(A65_BENCHMARK_PRECISION, duration / count) << " ns/expr" << std::endl;
+	}
+
+	return result;
+}
+
+std::string
+form_lexer_comment_source(void)
+{
+	std::stringstream result;
+
+	for(size_t index = 0; index < A65_BENCHMARK_ASSEMBLER_STATEMENT; ++index) {
+
+		for(size_t comment = 0; comment < A65_BENCHMARK_LEXER_COMMENT; ++comment) {
+			result << "\t\t\t; l" << index << ": load the accumulator, store it and branch back until the counter wraps" << std::endl;
+		}
+
+		result << std::endl << "\tnop\t\t\t\t; " << index << std::endl << std::endl;
+	}
+
+	return result.str();
+}
+
+int
+run_lexer_benchmarks(void)
+{
+	int result = EXIT_SUCCESS;
+
+	for(int benchmark = A65_BENCHMARK_LEXER_MIN; benchmark <= A65_BENCHMARK_LEXER_MAX; ++benchmark) {
+		double duration;
+		size_t length = 0;
+		std::string source;
+		std::chrono::high_resolution_clock::time_point begin;
+
+		source = ((benchmark == A65_BENCHMARK_LEXER_THROUGHPUT_COMMENT) ? form_lexer_comment_source() : form_assembler_source());
+		begin = std::chrono::high_resolution_clock::now();
+
+		for(size_t iteration = 0; iteration < A65_BENCHMARK_LEXER_ITERATION; ++iteration) {
+			a65_lexer lexer(source, false);
+
+			while(lexer.has_next()) {
+				lexer.move_next();
+			}
+
+			length += source.size();
+		}
+
+		duration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - begin).count();
+
+		std::cout << A65_COLUMN_WIDTH(A65_BENCHMARK_COLUMN_WIDTH) << A65_BENCHMARK_STRING(benchmark)
+			<< A65_FLOAT_PREC(A65_BENCHMARK_PRECISION, (length / duration) / (1024.0 * 1024.0)) << " MB/s ("
+			<< A65_STREAM_SCAN_STRING(a65_stream::scan_mode()) << ")" << std::endl;
+	}
+
+	return result;
+}
+
+int
+main(void)
+{
+	int result = EXIT_SUCCESS;
+
+	result = run_uuid_benchmarks();
+	if(result == EXIT_SUCCESS) {
+		result = run_assembler_benchmarks();
+	}
+
+	if(result == EXIT_SUCCESS) {
+		result = run_expression_benchmarks();
+	}
+
+	if(result == EXIT_SUCCESS) {
+		result = run_lexer_benchmarks();
+	}
+
+	return result;
+}
@@ -0,0 +1,88 @@
+/**
+ * A65
+ * Copyright (C) 2018 David Jolly
+ *
+ * A65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef A65_BENCHMARK_TYPE_H_
+#define A65_BENCHMARK_TYPE_H_
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "../inc/a65.h"
+#include "../inc/a65_assembler.h"
+#include "../inc/a65_utility.h"
+#include "../inc/a65_uuid.h"
+
+#define A65_BENCHMARK_ASSEMBLER_ITERATION 16
+#define A65_BENCHMARK_ASSEMBLER_STATEMENT 0x400
+
+#define A65_BENCHMARK_COLUMN_WIDTH 38
+
+#define A65_BENCHMARK_EXPRESSION_ITERATION 64
+
+#define A65_BENCHMARK_LEXER_COMMENT 4
+#define A65_BENCHMARK_LEXER_ITERATION 16
+
+#define A65_BENCHMARK_PRECISION 2
+
+#define A65_BENCHMARK_UUID_COPY 8
+#define A65_BENCHMARK_UUID_COUNT 0x40000
+#define A65_BENCHMARK_UUID_THREAD 4
+
+enum {
+	A65_BENCHMARK_UUID_LEGACY = 0,
+	A65_BENCHMARK_UUID_CONTEXT,
+	A65_BENCHMARK_UUID_CONTEXT_THREADED,
+	A65_BENCHMARK_ASSEMBLER_PASS_FIRST,
+	A65_BENCHMARK_ASSEMBLER_PASS_SECOND,
+	A65_BENCHMARK_EXPRESSION_COMPILE,
+	A65_BENCHMARK_EXPRESSION_EVALUATE,
+	A65_BENCHMARK_LEXER_THROUGHPUT,
+	A65_BENCHMARK_LEXER_THROUGHPUT_COMMENT,
+};
+
+#define A65_BENCHMARK_MAX A65_BENCHMARK_LEXER_THROUGHPUT_COMMENT
+
+#define A65_BENCHMARK_ASSEMBLER_MAX A65_BENCHMARK_ASSEMBLER_PASS_SECOND
+#define A65_BENCHMARK_ASSEMBLER_MIN A65_BENCHMARK_ASSEMBLER_PASS_FIRST
+
+#define A65_BENCHMARK_EXPRESSION_MAX A65_BENCHMARK_EXPRESSION_EVALUATE
+#define A65_BENCHMARK_EXPRESSION_MIN A65_BENCHMARK_EXPRESSION_COMPILE
+
+#define A65_BENCHMARK_LEXER_MAX A65_BENCHMARK_LEXER_THROUGHPUT_COMMENT
+#define A65_BENCHMARK_LEXER_MIN A65_BENCHMARK_LEXER_THROUGHPUT
+
+#define A65_BENCHMARK_UUID_MAX A65_BENCHMARK_UUID_CONTEXT_THREADED
+#define A65_BENCHMARK_UUID_MIN A65_BENCHMARK_UUID_LEGACY
+
+static const std::string A65_BENCHMARK_STR[] = {
+	"Benchmark::Uuid::Legacy",
+	"Benchmark::Uuid::Context",
+	"Benchmark::Uuid::Context-Threaded",
+	"Benchmark::Assembler::Pass-First",
+	"Benchmark::Assembler::Pass-Second",
+	"Benchmark::Expression::Compile",
+	"Benchmark::Expression::Evaluate",
+	"Benchmark::Lexer::Throughput",
+	"Benchmark::Lexer::Throughput-Comment",
+	};
+
+#define A65_BENCHMARK_STRING(_TYPE_) \
+	(((_TYPE_) > A65_BENCHMARK_MAX) ? A65_STRING_UNKNOWN : \
+		A65_STRING_CHECK(A65_BENCHMARK_STR[_TYPE_]))
+
+#endif // A65_BENCHMARK_TYPE_H_
@@ -51,7 +51,195 @@ is_file_matching(
 }
 
 bool
-run_functional_test(
+run_functional_test_build(
+	__in a65_context_t *context,
+	__in int test,
+	__in const std::string &expected
+	)
+{
+	bool result = true;
+	std::stringstream old_path, new_path, path;
+
+	path << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_SOURCE;
+
+	result = (a65_build_object_r(context, path.str().c_str(), A65_TEST_OUTPUT, 0, 0) == EXIT_SUCCESS);
+	if(result) {
+		old_path << A65_TEST_DIRECTORY(test) << expected;
+		new_path << A65_TEST_OUTPUT << A65_TEST_FUNCTIONAL_OBJECT_OUTPUT;
+		result = is_file_matching(old_path.str(), new_path.str());
+	}
+
+	return result;
+}
+
+bool
+run_functional_test_blob(
+	__in int test
+	)
+{
+	bool result = true;
+	std::stringstream large, object, path;
+	std::vector<uint8_t> data(A65_TEST_FUNCTIONAL_BLOB_LARGE_LENGTH);
+
+	large << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_BLOB_LARGE;
+	object << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_OBJECT;
+	path << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_SOURCE;
+
+	for(size_t offset = 0; offset < data.size(); ++offset) {
+		data.at(offset) = (offset * A65_TEST_FUNCTIONAL_BLOB_LARGE_STEP);
+	}
+
+	a65_utility::write_file(large.str(), data);
+	std::remove(A65_TEST_FUNCTIONAL_BLOB_LISTING_OUTPUT);
+
+	result = ((a65_build_object(path.str().c_str(), A65_TEST_OUTPUT, 0, 1) == EXIT_SUCCESS)
+			&& is_file_matching(object.str(), A65_TEST_FUNCTIONAL_OBJECT_OUTPUT));
+	if(result) {
+		std::string listing;
+
+		a65_utility::read_file(A65_TEST_FUNCTIONAL_BLOB_LISTING_OUTPUT, listing);
+		result = ((listing.find(A65_TEST_FUNCTIONAL_BLOB_LISTING) != std::string::npos)
+				&& (listing.find(A65_TEST_FUNCTIONAL_BLOB_LISTING_LARGE) != std::string::npos));
+	}
+
+	std::remove(A65_TEST_FUNCTIONAL_BLOB_LISTING_OUTPUT);
+	std::remove(large.str().c_str());
+
+	return result;
+}
+
+bool
+run_functional_test_cache(
+	__in int test
+	)
+{
+	bool result = true;
+	a65_context_t *context = nullptr;
+	std::stringstream first, missing, second;
+
+	first << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_INCLUDE_PATH_FIRST;
+	second << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_INCLUDE_PATH_SECOND;
+	missing << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_CACHE_MISSING;
+
+	context = a65_context_create();
+	result = (context != nullptr);
+	if(result) {
+		std::remove(missing.str().c_str());
+
+		result = ((a65_add_include_path_r(context, first.str().c_str()) == EXIT_SUCCESS)
+				&& (a65_add_include_path_r(context, second.str().c_str()) == EXIT_SUCCESS)
+				&& (a65_set_cache_path_r(context, A65_TEST_OUTPUT) == EXIT_SUCCESS)
+				&& run_functional_test_build(context, test, A65_TEST_FUNCTIONAL_OBJECT)
+				&& run_functional_test_build(context, test, A65_TEST_FUNCTIONAL_OBJECT)
+				&& (a65_statistic_r(context, A65_STATISTIC_CACHE_HIT) == 1));
+		if(result) {
+			a65_utility::write_file(missing.str(), A65_TEST_FUNCTIONAL_CACHE_MISSING_SOURCE);
+			result = (run_functional_test_build(context, test, A65_TEST_FUNCTIONAL_REBUILD)
+					&& run_functional_test_build(context, test, A65_TEST_FUNCTIONAL_REBUILD)
+					&& (a65_statistic_r(context, A65_STATISTIC_CACHE_HIT) == 1));
+		}
+
+		std::remove(missing.str().c_str());
+		a65_context_destroy(context);
+	}
+
+	return result;
+}
+
+bool
+run_functional_test_depend(
+	__in int test
+	)
+{
+	bool result = true;
+	a65_context_t *context = nullptr;
+	std::stringstream expected, output;
+
+	expected << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_DEPEND_FILE;
+	output << A65_TEST_OUTPUT << A65_TEST_FUNCTIONAL_DEPEND_OUTPUT;
+
+	context = a65_context_create();
+	result = (context != nullptr);
+	if(result) {
+		std::remove(output.str().c_str());
+		std::remove(A65_TEST_FUNCTIONAL_DEPEND_PATH);
+
+		result = ((a65_set_cache_path_r(context, A65_TEST_OUTPUT) == EXIT_SUCCESS)
+				&& (a65_set_option_r(context, A65_OPTION_DEPEND, true) == EXIT_SUCCESS)
+				&& run_functional_test_build(context, test, A65_TEST_FUNCTIONAL_OBJECT)
+				&& is_file_matching(expected.str(), output.str()));
+		if(result) {
+			result = ((a65_set_depend_path_r(context, A65_TEST_FUNCTIONAL_DEPEND_PATH) == EXIT_SUCCESS)
+					&& run_functional_test_build(context, test, A65_TEST_FUNCTIONAL_OBJECT)
+					&& (a65_statistic_r(context, A65_STATISTIC_CACHE_HIT) == 1)
+					&& is_file_matching(expected.str(), A65_TEST_FUNCTIONAL_DEPEND_PATH));
+		}
+
+		std::remove(output.str().c_str());
+		std::remove(A65_TEST_FUNCTIONAL_DEPEND_PATH);
+		a65_context_destroy(context);
+	}
+
+	return result;
+}
+
+bool
+run_functional_test_include(
+	__in int test
+	)
+{
+	bool result = true;
+	a65_context_t *context = nullptr;
+	std::stringstream first, late, second, stale;
+
+	first << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_INCLUDE_PATH_FIRST;
+	second << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_INCLUDE_PATH_SECOND;
+	late << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_INCLUDE_LATE;
+	stale << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_INCLUDE_STALE;
+
+	context = a65_context_create();
+	result = (context != nullptr);
+	if(result) {
+		std::remove(late.str().c_str());
+		a65_utility::write_file(stale.str(), A65_TEST_FUNCTIONAL_INCLUDE_STALE_SOURCE);
+
+		result = ((a65_add_include_path_r(context, first.str().c_str()) == EXIT_SUCCESS)
+				&& (a65_add_include_path_r(context, second.str().c_str()) == EXIT_SUCCESS)
+				&& run_functional_test_build(context, test, A65_TEST_FUNCTIONAL_OBJECT));
+		if(result) {
+			a65_utility::write_file(late.str(), A65_TEST_FUNCTIONAL_INCLUDE_LATE_SOURCE);
+			a65_utility::write_file(stale.str(), A65_TEST_FUNCTIONAL_INCLUDE_STALE_SOURCE_REBUILD);
+			result = run_functional_test_build(context, test, A65_TEST_FUNCTIONAL_REBUILD);
+		}
+
+		std::remove(late.str().c_str());
+		std::remove(stale.str().c_str());
+		a65_context_destroy(context);
+	}
+
+	return result;
+}
+
+bool
+run_functional_test_layout(
+	__in int test
+	)
+{
+	bool result = true;
+	std::stringstream path;
+
+	path << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_LAYOUT_DIVERGE;
+
+	result = (a65_build_object(path.str().c_str(), A65_TEST_OUTPUT, 0, 0) == EXIT_FAILURE);
+	if(result) {
+		result = (std::string(a65_error()).find(A65_TEST_FUNCTIONAL_LAYOUT_ERROR) != std::string::npos);
+	}
+
+	return result;
+}
+
+bool
+run_functional_test_object(
 	__in int test
 	)
 {
@@ -95,19 +283,159 @@ run_functional_test(
 	return result;
 }
 
+bool
+run_functional_test_precompile(
+	__in int test
+	)
+{
+	bool result = true;
+	a65_context_t *context = nullptr;
+	std::stringstream include, path, source;
+
+	include << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_PRECOMPILE_INCLUDE;
+	path << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_PRECOMPILE_PATH;
+	source << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_PRECOMPILE_SOURCE;
+
+	context = a65_context_create();
+	result = (context != nullptr);
+	if(result) {
+		a65_utility::write_file(source.str(), A65_TEST_FUNCTIONAL_PRECOMPILE_SOURCE_VALUE);
+
+		result = ((a65_add_include_path_r(context, path.str().c_str()) == EXIT_SUCCESS)
+				&& (a65_precompile_r(context, source.str().c_str(), A65_TEST_DIRECTORY(test)) == EXIT_SUCCESS)
+				&& run_functional_test_build(context, test, A65_TEST_FUNCTIONAL_OBJECT));
+		if(result) {
+			a65_utility::write_file(source.str(), A65_TEST_FUNCTIONAL_PRECOMPILE_SOURCE_VALUE_REBUILD);
+			result = run_functional_test_build(context, test, A65_TEST_FUNCTIONAL_REBUILD);
+		}
+
+		if(result) {
+			std::vector<uint8_t> data;
+
+			a65_utility::read_file(include.str(), data);
+
+			result = (data.size() >= sizeof(a65_object_header_t));
+			if(result) {
+				++((a65_object_header_t *)data.data())->metadata.minor;
+				a65_utility::write_file(include.str(), data);
+				result = run_functional_test_build(context, test, A65_TEST_FUNCTIONAL_REBUILD);
+			}
+		}
+
+		std::remove(include.str().c_str());
+		std::remove(source.str().c_str());
+		a65_context_destroy(context);
+	}
+
+	return result;
+}
+
+bool
+run_functional_test_relax(
+	__in int test
+	)
+{
+	bool result = true;
+
+	a65_set_option(A65_OPTION_RELAX, true);
+
+	result = run_functional_test_object(test);
+	if(result) {
+		result = (a65_statistic(A65_STATISTIC_RELAXED) == A65_TEST_FUNCTIONAL_RELAX_COUNT);
+	}
+
+	a65_set_option(A65_OPTION_RELAX, false);
+
+	return result;
+}
+
+bool
+run_functional_test_snapshot(
+	__in int test
+	)
+{
+	bool result = true;
+	std::stringstream value;
+	a65_context_t *context = nullptr;
+
+	value << A65_TEST_DIRECTORY(test) << A65_TEST_FUNCTIONAL_SNAPSHOT_VALUE;
+
+	context = a65_context_create();
+	result = (context != nullptr);
+	if(result) {
+		a65_utility::write_file(value.str(), A65_TEST_FUNCTIONAL_SNAPSHOT_VALUE_SOURCE);
+
+		result = run_functional_test_build(context, test, A65_TEST_FUNCTIONAL_OBJECT);
+		if(result) {
+			a65_utility::write_file(value.str(), A65_TEST_FUNCTIONAL_SNAPSHOT_VALUE_SOURCE_REBUILD);
+			result = run_functional_test_build(context, test, A65_TEST_FUNCTIONAL_REBUILD);
+		}
+
+		std::remove(value.str().c_str());
+		a65_context_destroy(context);
+	}
+
+	return result;
+}
+
+bool
+run_functional_test(
+	__in int test
+	)
+{
+	bool result = true;
+
+	switch(test) {
+		case A65_TEST_FUNCTIONAL_BLOB:
+			result = run_functional_test_blob(test);
+			break;
+		case A65_TEST_FUNCTIONAL_CACHE:
+			result = run_functional_test_cache(test);
+			break;
+		case A65_TEST_FUNCTIONAL_DEPEND:
+			result = run_functional_test_depend(test);
+			break;
+		case A65_TEST_FUNCTIONAL_INCLUDE:
+			result = run_functional_test_include(test);
+			break;
+		case A65_TEST_FUNCTIONAL_LAYOUT:
+			result = (run_functional_test_object(test) && run_functional_test_layout(test));
+			break;
+		case A65_TEST_FUNCTIONAL_PRECOMPILE:
+			result = run_functional_test_precompile(test);
+			break;
+		case A65_TEST_FUNCTIONAL_RELAX:
+			result = run_functional_test_relax(test);
+			break;
+		case A65_TEST_FUNCTIONAL_SNAPSHOT:
+			result = run_functional_test_snapshot(test);
+			break;
+		default:
+			result = run_functional_test_object(test);
+			break;
+	}
+
+	return result;
+}
+
 int
 run_functional_tests(void)
 {
 	int result = EXIT_SUCCESS;
 
 	for(int test = A65_TEST_FUNCTIONAL_MIN; test <= A65_TEST_FUNCTIONAL_MAX; ++test) {
+		bool passed;
+
 		std::cout << A65_COLUMN_WIDTH(A65_TEST_COLUMN_WIDTH) << A65_TEST_STRING(test) << "[";
 
-		result = (run_functional_test(test) ? EXIT_SUCCESS : EXIT_FAILURE);
+		passed = run_functional_test(test);
+		if(!passed) {
+			result = EXIT_FAILURE;
+		}
 #ifdef TRACE_COLOR
-		std::cout << A65_DEBUG_COLOR_STRING((result == EXIT_SUCCESS) ? A65_DEBUG_LEVEL_INFORMATION : A65_DEBUG_LEVEL_ERROR);
+		std::cout << A65_DEBUG_COLOR_STRING(passed ? A65_DEBUG_LEVEL_INFORMATION : A65_DEBUG_LEVEL_ERROR);
 #endif // TRACE_COLOR
-		std::cout << ((result == EXIT_SUCCESS) ? "PASS" : "FAIL");
+		std::cout << (passed ? "PASS" : "FAIL");
 #ifdef TRACE_COLOR
 		std::cout << A65_DEBUG_COLOR_OFF;
 #endif // TRACE_COLOR
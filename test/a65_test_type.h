@@ -20,6 +20,7 @@
 #define A65_TEST_TYPE_H_
 
 #include "../inc/a65.h"
+#include "../inc/a65_object_type.h"
 #include "../inc/a65_utility.h"
 
 #define A65_TEST_COLUMN_WIDTH 38
@@ -28,19 +29,58 @@
 
 #define A65_TEST_FUNCTIONAL_BINARY "binary.bin"
 #define A65_TEST_FUNCTIONAL_BINARY_NAME "binary"
+#define A65_TEST_FUNCTIONAL_BLOB_LARGE "large.bin"
+#define A65_TEST_FUNCTIONAL_BLOB_LARGE_LENGTH 0x4003
+#define A65_TEST_FUNCTIONAL_BLOB_LARGE_STEP 7
+#define A65_TEST_FUNCTIONAL_BLOB_LISTING ".db 0x01, 0x02, 0x03, 0xff\n\tlda #0x01\n"
+#define A65_TEST_FUNCTIONAL_BLOB_LISTING_LARGE ", 0xf9, 0x00, 0x07, 0x0e\n\tbrk"
+#define A65_TEST_FUNCTIONAL_BLOB_LISTING_OUTPUT "source.S"
+#define A65_TEST_FUNCTIONAL_CACHE_MISSING "a/h.inc"
+#define A65_TEST_FUNCTIONAL_CACHE_MISSING_SOURCE "\t.db 0xaa\n"
+#define A65_TEST_FUNCTIONAL_DEPEND_FILE "depend.d"
+#define A65_TEST_FUNCTIONAL_DEPEND_OUTPUT "source.d"
+#define A65_TEST_FUNCTIONAL_DEPEND_PATH "./depend.d"
+#define A65_TEST_FUNCTIONAL_INCLUDE_LATE "a/late.inc"
+#define A65_TEST_FUNCTIONAL_INCLUDE_LATE_SOURCE "\t.db 0xa0\n"
+#define A65_TEST_FUNCTIONAL_INCLUDE_PATH_FIRST "a"
+#define A65_TEST_FUNCTIONAL_INCLUDE_PATH_SECOND "b"
+#define A65_TEST_FUNCTIONAL_INCLUDE_STALE "stale.inc"
+#define A65_TEST_FUNCTIONAL_INCLUDE_STALE_SOURCE "\t.db 0x11\n"
+#define A65_TEST_FUNCTIONAL_INCLUDE_STALE_SOURCE_REBUILD "\t.db 0x33, 0x33\n"
+#define A65_TEST_FUNCTIONAL_LAYOUT_DIVERGE "diverge.asm"
+#define A65_TEST_FUNCTIONAL_LAYOUT_ERROR "Layout did not converge"
 #define A65_TEST_FUNCTIONAL_OBJECT "object.o"
 #define A65_TEST_FUNCTIONAL_OBJECT_OUTPUT "source.o"
+#define A65_TEST_FUNCTIONAL_PRECOMPILE_INCLUDE "regs.a65p"
+#define A65_TEST_FUNCTIONAL_PRECOMPILE_PATH "nested"
+#define A65_TEST_FUNCTIONAL_PRECOMPILE_SOURCE "regs.inc"
+#define A65_TEST_FUNCTIONAL_PRECOMPILE_SOURCE_VALUE "\t.db 0x11\n\t@inc \"value.inc\"\n"
+#define A65_TEST_FUNCTIONAL_PRECOMPILE_SOURCE_VALUE_REBUILD "\t.db 0x22\n\t@inc \"value.inc\"\n"
+#define A65_TEST_FUNCTIONAL_REBUILD "rebuild.o"
+#define A65_TEST_FUNCTIONAL_RELAX_COUNT 4
+#define A65_TEST_FUNCTIONAL_SNAPSHOT_VALUE "value.inc"
+#define A65_TEST_FUNCTIONAL_SNAPSHOT_VALUE_SOURCE "\t.db 0x11\n"
+#define A65_TEST_FUNCTIONAL_SNAPSHOT_VALUE_SOURCE_REBUILD "\t.db 0x22\n"
 #define A65_TEST_FUNCTIONAL_SOURCE "source.asm"
 
 enum {
 	A65_TEST_FUNCTIONAL_ADVANCED = 0,
+	A65_TEST_FUNCTIONAL_BLOB,
 	A65_TEST_FUNCTIONAL_BRANCH,
+	A65_TEST_FUNCTIONAL_CACHE,
+	A65_TEST_FUNCTIONAL_DEPEND,
+	A65_TEST_FUNCTIONAL_INCLUDE,
 	A65_TEST_FUNCTIONAL_INDEX_INDIRECT,
 	A65_TEST_FUNCTIONAL_INDIRECT,
 	A65_TEST_FUNCTIONAL_INDIRECT_INDEX,
 	A65_TEST_FUNCTIONAL_JUMP,
+	A65_TEST_FUNCTIONAL_LAYOUT,
+	A65_TEST_FUNCTIONAL_MAPPED,
+	A65_TEST_FUNCTIONAL_PRECOMPILE,
 	A65_TEST_FUNCTIONAL_RELATIVE,
+	A65_TEST_FUNCTIONAL_RELAX,
 	A65_TEST_FUNCTIONAL_SIMPLE,
+	A65_TEST_FUNCTIONAL_SNAPSHOT,
 	A65_TEST_FUNCTIONAL_STACK,
 	A65_TEST_FUNCTIONAL_SUBROUTINE,
 };
@@ -52,13 +92,22 @@ enum {
 
 static const std::string A65_TEST_DIR[] = {
 	"./functional/advanced/",
+	"./functional/blob/",
 	"./functional/branch/",
+	"./functional/cache/",
+	"./functional/depend/",
+	"./functional/include/",
 	"./functional/index_indirect/",
 	"./functional/indirect/",
 	"./functional/indirect_index/",
 	"./functional/jump/",
+	"./functional/layout/",
+	"./functional/mapped/",
+	"./functional/precompile/",
 	"./functional/relative/",
+	"./functional/relax/",
 	"./functional/simple/",
+	"./functional/snapshot/",
 	"./functional/stack/",
 	"./functional/subroutine/",
 	};
@@ -69,13 +118,22 @@ static const std::string A65_TEST_DIR[] = {
 
 static const std::string A65_TEST_STR[] = {
 	"Test::Functional::Advanced",
+	"Test::Functional::Blob",
 	"Test::Functional::Branch",
+	"Test::Functional::Cache",
+	"Test::Functional::Depend",
+	"Test::Functional::Include",
 	"Test::Functional::Index-Indirect",
 	"Test::Functional::Indirect",
 	"Test::Functional::Indirect-Index",
 	"Test::Functional::Jump",
+	"Test::Functional::Layout",
+	"Test::Functional::Mapped",
+	"Test::Functional::Precompile",
 	"Test::Functional::Relative",
+	"Test::Functional::Relax",
 	"Test::Functional::Simple",
+	"Test::Functional::Snapshot",
 	"Test::Functional::Stack",
 	"Test::Functional::Subroutine",
 	};
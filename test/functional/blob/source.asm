@@ -0,0 +1,8 @@
+	.org 0x0600
+
+	@incb "small.bin"
+	lda #0x01
+	@incb "empty.bin"
+	@incb "large.bin"
+
+	brk
@@ -0,0 +1,6 @@
+	.org 0x0600
+
+	@inc "h.inc"
+	@inc "l.inc"
+
+	brk
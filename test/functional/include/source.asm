@@ -0,0 +1,11 @@
+	.org 0x0600
+
+	@inc "guard.inc"
+	@inc "guard.inc"
+	@inc "once.inc"
+	@inc "once.inc"
+	@inc "search.inc"
+	@inc "late.inc"
+	@inc "stale.inc"
+
+	brk
@@ -0,0 +1,5 @@
+	.org 0x0600
+
+	.res 0x0700 - over
+over:
+	brk
@@ -0,0 +1,16 @@
+	.org 0x00fe
+
+	lda 0x0200 - over
+over:
+
+	.org 0x01fe
+
+.if 1 == 1
+	ldx 0x0300 - nested, y
+.endif
+nested:
+	lda zero
+	brk
+
+	.org 0x0010
+zero:
@@ -0,0 +1,1514 @@
+; mapped test: a source and an include large enough to be read through a mapping
+
+	.org 0x0600
+
+	lda #0x00
+	sta 0x0200
+	lda #0x01
+	sta 0x0201
+	lda #0x02
+	sta 0x0202
+	lda #0x03
+	sta 0x0203
+	lda #0x04
+	sta 0x0204
+	lda #0x05
+	sta 0x0205
+	lda #0x06
+	sta 0x0206
+	lda #0x07
+	sta 0x0207
+	lda #0x08
+	sta 0x0208
+	lda #0x09
+	sta 0x0209
+	lda #0x0a
+	sta 0x020a
+	lda #0x0b
+	sta 0x020b
+	lda #0x0c
+	sta 0x020c
+	lda #0x0d
+	sta 0x020d
+	lda #0x0e
+	sta 0x020e
+	lda #0x0f
+	sta 0x020f
+	lda #0x10
+	sta 0x0210
+	lda #0x11
+	sta 0x0211
+	lda #0x12
+	sta 0x0212
+	lda #0x13
+	sta 0x0213
+	lda #0x14
+	sta 0x0214
+	lda #0x15
+	sta 0x0215
+	lda #0x16
+	sta 0x0216
+	lda #0x17
+	sta 0x0217
+	lda #0x18
+	sta 0x0218
+	lda #0x19
+	sta 0x0219
+	lda #0x1a
+	sta 0x021a
+	lda #0x1b
+	sta 0x021b
+	lda #0x1c
+	sta 0x021c
+	lda #0x1d
+	sta 0x021d
+	lda #0x1e
+	sta 0x021e
+	lda #0x1f
+	sta 0x021f
+	lda #0x20
+	sta 0x0220
+	lda #0x21
+	sta 0x0221
+	lda #0x22
+	sta 0x0222
+	lda #0x23
+	sta 0x0223
+	lda #0x24
+	sta 0x0224
+	lda #0x25
+	sta 0x0225
+	lda #0x26
+	sta 0x0226
+	lda #0x27
+	sta 0x0227
+	lda #0x28
+	sta 0x0228
+	lda #0x29
+	sta 0x0229
+	lda #0x2a
+	sta 0x022a
+	lda #0x2b
+	sta 0x022b
+	lda #0x2c
+	sta 0x022c
+	lda #0x2d
+	sta 0x022d
+	lda #0x2e
+	sta 0x022e
+	lda #0x2f
+	sta 0x022f
+	lda #0x30
+	sta 0x0230
+	lda #0x31
+	sta 0x0231
+	lda #0x32
+	sta 0x0232
+	lda #0x33
+	sta 0x0233
+	lda #0x34
+	sta 0x0234
+	lda #0x35
+	sta 0x0235
+	lda #0x36
+	sta 0x0236
+	lda #0x37
+	sta 0x0237
+	lda #0x38
+	sta 0x0238
+	lda #0x39
+	sta 0x0239
+	lda #0x3a
+	sta 0x023a
+	lda #0x3b
+	sta 0x023b
+	lda #0x3c
+	sta 0x023c
+	lda #0x3d
+	sta 0x023d
+	lda #0x3e
+	sta 0x023e
+	lda #0x3f
+	sta 0x023f
+	lda #0x40
+	sta 0x0240
+	lda #0x41
+	sta 0x0241
+	lda #0x42
+	sta 0x0242
+	lda #0x43
+	sta 0x0243
+	lda #0x44
+	sta 0x0244
+	lda #0x45
+	sta 0x0245
+	lda #0x46
+	sta 0x0246
+	lda #0x47
+	sta 0x0247
+	lda #0x48
+	sta 0x0248
+	lda #0x49
+	sta 0x0249
+	lda #0x4a
+	sta 0x024a
+	lda #0x4b
+	sta 0x024b
+	lda #0x4c
+	sta 0x024c
+	lda #0x4d
+	sta 0x024d
+	lda #0x4e
+	sta 0x024e
+	lda #0x4f
+	sta 0x024f
+	lda #0x50
+	sta 0x0250
+	lda #0x51
+	sta 0x0251
+	lda #0x52
+	sta 0x0252
+	lda #0x53
+	sta 0x0253
+	lda #0x54
+	sta 0x0254
+	lda #0x55
+	sta 0x0255
+	lda #0x56
+	sta 0x0256
+	lda #0x57
+	sta 0x0257
+	lda #0x58
+	sta 0x0258
+	lda #0x59
+	sta 0x0259
+	lda #0x5a
+	sta 0x025a
+	lda #0x5b
+	sta 0x025b
+	lda #0x5c
+	sta 0x025c
+	lda #0x5d
+	sta 0x025d
+	lda #0x5e
+	sta 0x025e
+	lda #0x5f
+	sta 0x025f
+	lda #0x60
+	sta 0x0260
+	lda #0x61
+	sta 0x0261
+	lda #0x62
+	sta 0x0262
+	lda #0x63
+	sta 0x0263
+	lda #0x64
+	sta 0x0264
+	lda #0x65
+	sta 0x0265
+	lda #0x66
+	sta 0x0266
+	lda #0x67
+	sta 0x0267
+	lda #0x68
+	sta 0x0268
+	lda #0x69
+	sta 0x0269
+	lda #0x6a
+	sta 0x026a
+	lda #0x6b
+	sta 0x026b
+	lda #0x6c
+	sta 0x026c
+	lda #0x6d
+	sta 0x026d
+	lda #0x6e
+	sta 0x026e
+	lda #0x6f
+	sta 0x026f
+	lda #0x70
+	sta 0x0270
+	lda #0x71
+	sta 0x0271
+	lda #0x72
+	sta 0x0272
+	lda #0x73
+	sta 0x0273
+	lda #0x74
+	sta 0x0274
+	lda #0x75
+	sta 0x0275
+	lda #0x76
+	sta 0x0276
+	lda #0x77
+	sta 0x0277
+	lda #0x78
+	sta 0x0278
+	lda #0x79
+	sta 0x0279
+	lda #0x7a
+	sta 0x027a
+	lda #0x7b
+	sta 0x027b
+	lda #0x7c
+	sta 0x027c
+	lda #0x7d
+	sta 0x027d
+	lda #0x7e
+	sta 0x027e
+	lda #0x7f
+	sta 0x027f
+	lda #0x80
+	sta 0x0280
+	lda #0x81
+	sta 0x0281
+	lda #0x82
+	sta 0x0282
+	lda #0x83
+	sta 0x0283
+	lda #0x84
+	sta 0x0284
+	lda #0x85
+	sta 0x0285
+	lda #0x86
+	sta 0x0286
+	lda #0x87
+	sta 0x0287
+	lda #0x88
+	sta 0x0288
+	lda #0x89
+	sta 0x0289
+	lda #0x8a
+	sta 0x028a
+	lda #0x8b
+	sta 0x028b
+	lda #0x8c
+	sta 0x028c
+	lda #0x8d
+	sta 0x028d
+	lda #0x8e
+	sta 0x028e
+	lda #0x8f
+	sta 0x028f
+	lda #0x90
+	sta 0x0290
+	lda #0x91
+	sta 0x0291
+	lda #0x92
+	sta 0x0292
+	lda #0x93
+	sta 0x0293
+	lda #0x94
+	sta 0x0294
+	lda #0x95
+	sta 0x0295
+	lda #0x96
+	sta 0x0296
+	lda #0x97
+	sta 0x0297
+	lda #0x98
+	sta 0x0298
+	lda #0x99
+	sta 0x0299
+	lda #0x9a
+	sta 0x029a
+	lda #0x9b
+	sta 0x029b
+	lda #0x9c
+	sta 0x029c
+	lda #0x9d
+	sta 0x029d
+	lda #0x9e
+	sta 0x029e
+	lda #0x9f
+	sta 0x029f
+	lda #0xa0
+	sta 0x02a0
+	lda #0xa1
+	sta 0x02a1
+	lda #0xa2
+	sta 0x02a2
+	lda #0xa3
+	sta 0x02a3
+	lda #0xa4
+	sta 0x02a4
+	lda #0xa5
+	sta 0x02a5
+	lda #0xa6
+	sta 0x02a6
+	lda #0xa7
+	sta 0x02a7
+	lda #0xa8
+	sta 0x02a8
+	lda #0xa9
+	sta 0x02a9
+	lda #0xaa
+	sta 0x02aa
+	lda #0xab
+	sta 0x02ab
+	lda #0xac
+	sta 0x02ac
+	lda #0xad
+	sta 0x02ad
+	lda #0xae
+	sta 0x02ae
+	lda #0xaf
+	sta 0x02af
+	lda #0xb0
+	sta 0x02b0
+	lda #0xb1
+	sta 0x02b1
+	lda #0xb2
+	sta 0x02b2
+	lda #0xb3
+	sta 0x02b3
+	lda #0xb4
+	sta 0x02b4
+	lda #0xb5
+	sta 0x02b5
+	lda #0xb6
+	sta 0x02b6
+	lda #0xb7
+	sta 0x02b7
+	lda #0xb8
+	sta 0x02b8
+	lda #0xb9
+	sta 0x02b9
+	lda #0xba
+	sta 0x02ba
+	lda #0xbb
+	sta 0x02bb
+	lda #0xbc
+	sta 0x02bc
+	lda #0xbd
+	sta 0x02bd
+	lda #0xbe
+	sta 0x02be
+	lda #0xbf
+	sta 0x02bf
+	lda #0xc0
+	sta 0x02c0
+	lda #0xc1
+	sta 0x02c1
+	lda #0xc2
+	sta 0x02c2
+	lda #0xc3
+	sta 0x02c3
+	lda #0xc4
+	sta 0x02c4
+	lda #0xc5
+	sta 0x02c5
+	lda #0xc6
+	sta 0x02c6
+	lda #0xc7
+	sta 0x02c7
+	lda #0xc8
+	sta 0x02c8
+	lda #0xc9
+	sta 0x02c9
+	lda #0xca
+	sta 0x02ca
+	lda #0xcb
+	sta 0x02cb
+	lda #0xcc
+	sta 0x02cc
+	lda #0xcd
+	sta 0x02cd
+	lda #0xce
+	sta 0x02ce
+	lda #0xcf
+	sta 0x02cf
+	lda #0xd0
+	sta 0x02d0
+	lda #0xd1
+	sta 0x02d1
+	lda #0xd2
+	sta 0x02d2
+	lda #0xd3
+	sta 0x02d3
+	lda #0xd4
+	sta 0x02d4
+	lda #0xd5
+	sta 0x02d5
+	lda #0xd6
+	sta 0x02d6
+	lda #0xd7
+	sta 0x02d7
+	lda #0xd8
+	sta 0x02d8
+	lda #0xd9
+	sta 0x02d9
+	lda #0xda
+	sta 0x02da
+	lda #0xdb
+	sta 0x02db
+	lda #0xdc
+	sta 0x02dc
+	lda #0xdd
+	sta 0x02dd
+	lda #0xde
+	sta 0x02de
+	lda #0xdf
+	sta 0x02df
+	lda #0xe0
+	sta 0x02e0
+	lda #0xe1
+	sta 0x02e1
+	lda #0xe2
+	sta 0x02e2
+	lda #0xe3
+	sta 0x02e3
+	lda #0xe4
+	sta 0x02e4
+	lda #0xe5
+	sta 0x02e5
+	lda #0xe6
+	sta 0x02e6
+	lda #0xe7
+	sta 0x02e7
+	lda #0xe8
+	sta 0x02e8
+	lda #0xe9
+	sta 0x02e9
+	lda #0xea
+	sta 0x02ea
+	lda #0xeb
+	sta 0x02eb
+	lda #0xec
+	sta 0x02ec
+	lda #0xed
+	sta 0x02ed
+	lda #0xee
+	sta 0x02ee
+	lda #0xef
+	sta 0x02ef
+	lda #0xf0
+	sta 0x02f0
+	lda #0xf1
+	sta 0x02f1
+	lda #0xf2
+	sta 0x02f2
+	lda #0xf3
+	sta 0x02f3
+	lda #0xf4
+	sta 0x02f4
+	lda #0xf5
+	sta 0x02f5
+	lda #0xf6
+	sta 0x02f6
+	lda #0xf7
+	sta 0x02f7
+	lda #0xf8
+	sta 0x02f8
+	lda #0xf9
+	sta 0x02f9
+	lda #0xfa
+	sta 0x02fa
+	lda #0xfb
+	sta 0x02fb
+	lda #0xfc
+	sta 0x02fc
+	lda #0xfd
+	sta 0x02fd
+	lda #0xfe
+	sta 0x02fe
+	lda #0xff
+	sta 0x02ff
+	lda #0x00
+	sta 0x0300
+	lda #0x01
+	sta 0x0301
+	lda #0x02
+	sta 0x0302
+	lda #0x03
+	sta 0x0303
+	lda #0x04
+	sta 0x0304
+	lda #0x05
+	sta 0x0305
+	lda #0x06
+	sta 0x0306
+	lda #0x07
+	sta 0x0307
+	lda #0x08
+	sta 0x0308
+	lda #0x09
+	sta 0x0309
+	lda #0x0a
+	sta 0x030a
+	lda #0x0b
+	sta 0x030b
+	lda #0x0c
+	sta 0x030c
+	lda #0x0d
+	sta 0x030d
+	lda #0x0e
+	sta 0x030e
+	lda #0x0f
+	sta 0x030f
+	lda #0x10
+	sta 0x0310
+	lda #0x11
+	sta 0x0311
+	lda #0x12
+	sta 0x0312
+	lda #0x13
+	sta 0x0313
+	lda #0x14
+	sta 0x0314
+	lda #0x15
+	sta 0x0315
+	lda #0x16
+	sta 0x0316
+	lda #0x17
+	sta 0x0317
+	lda #0x18
+	sta 0x0318
+	lda #0x19
+	sta 0x0319
+	lda #0x1a
+	sta 0x031a
+	lda #0x1b
+	sta 0x031b
+	lda #0x1c
+	sta 0x031c
+	lda #0x1d
+	sta 0x031d
+	lda #0x1e
+	sta 0x031e
+	lda #0x1f
+	sta 0x031f
+	lda #0x20
+	sta 0x0320
+	lda #0x21
+	sta 0x0321
+	lda #0x22
+	sta 0x0322
+	lda #0x23
+	sta 0x0323
+	lda #0x24
+	sta 0x0324
+	lda #0x25
+	sta 0x0325
+	lda #0x26
+	sta 0x0326
+	lda #0x27
+	sta 0x0327
+	lda #0x28
+	sta 0x0328
+	lda #0x29
+	sta 0x0329
+	lda #0x2a
+	sta 0x032a
+	lda #0x2b
+	sta 0x032b
+	lda #0x2c
+	sta 0x032c
+	lda #0x2d
+	sta 0x032d
+	lda #0x2e
+	sta 0x032e
+	lda #0x2f
+	sta 0x032f
+	lda #0x30
+	sta 0x0330
+	lda #0x31
+	sta 0x0331
+	lda #0x32
+	sta 0x0332
+	lda #0x33
+	sta 0x0333
+	lda #0x34
+	sta 0x0334
+	lda #0x35
+	sta 0x0335
+	lda #0x36
+	sta 0x0336
+	lda #0x37
+	sta 0x0337
+	lda #0x38
+	sta 0x0338
+	lda #0x39
+	sta 0x0339
+	lda #0x3a
+	sta 0x033a
+	lda #0x3b
+	sta 0x033b
+	lda #0x3c
+	sta 0x033c
+	lda #0x3d
+	sta 0x033d
+	lda #0x3e
+	sta 0x033e
+	lda #0x3f
+	sta 0x033f
+	lda #0x40
+	sta 0x0340
+	lda #0x41
+	sta 0x0341
+	lda #0x42
+	sta 0x0342
+	lda #0x43
+	sta 0x0343
+	lda #0x44
+	sta 0x0344
+	lda #0x45
+	sta 0x0345
+	lda #0x46
+	sta 0x0346
+	lda #0x47
+	sta 0x0347
+	lda #0x48
+	sta 0x0348
+	lda #0x49
+	sta 0x0349
+	lda #0x4a
+	sta 0x034a
+	lda #0x4b
+	sta 0x034b
+	lda #0x4c
+	sta 0x034c
+	lda #0x4d
+	sta 0x034d
+	lda #0x4e
+	sta 0x034e
+	lda #0x4f
+	sta 0x034f
+	lda #0x50
+	sta 0x0350
+	lda #0x51
+	sta 0x0351
+	lda #0x52
+	sta 0x0352
+	lda #0x53
+	sta 0x0353
+	lda #0x54
+	sta 0x0354
+	lda #0x55
+	sta 0x0355
+	lda #0x56
+	sta 0x0356
+	lda #0x57
+	sta 0x0357
+	lda #0x58
+	sta 0x0358
+	lda #0x59
+	sta 0x0359
+	lda #0x5a
+	sta 0x035a
+	lda #0x5b
+	sta 0x035b
+	lda #0x5c
+	sta 0x035c
+	lda #0x5d
+	sta 0x035d
+	lda #0x5e
+	sta 0x035e
+	lda #0x5f
+	sta 0x035f
+	lda #0x60
+	sta 0x0360
+	lda #0x61
+	sta 0x0361
+	lda #0x62
+	sta 0x0362
+	lda #0x63
+	sta 0x0363
+	lda #0x64
+	sta 0x0364
+	lda #0x65
+	sta 0x0365
+	lda #0x66
+	sta 0x0366
+	lda #0x67
+	sta 0x0367
+	lda #0x68
+	sta 0x0368
+	lda #0x69
+	sta 0x0369
+	lda #0x6a
+	sta 0x036a
+	lda #0x6b
+	sta 0x036b
+	lda #0x6c
+	sta 0x036c
+	lda #0x6d
+	sta 0x036d
+	lda #0x6e
+	sta 0x036e
+	lda #0x6f
+	sta 0x036f
+	lda #0x70
+	sta 0x0370
+	lda #0x71
+	sta 0x0371
+	lda #0x72
+	sta 0x0372
+	lda #0x73
+	sta 0x0373
+	lda #0x74
+	sta 0x0374
+	lda #0x75
+	sta 0x0375
+	lda #0x76
+	sta 0x0376
+	lda #0x77
+	sta 0x0377
+	lda #0x78
+	sta 0x0378
+	lda #0x79
+	sta 0x0379
+	lda #0x7a
+	sta 0x037a
+	lda #0x7b
+	sta 0x037b
+	lda #0x7c
+	sta 0x037c
+	lda #0x7d
+	sta 0x037d
+	lda #0x7e
+	sta 0x037e
+	lda #0x7f
+	sta 0x037f
+	lda #0x80
+	sta 0x0380
+	lda #0x81
+	sta 0x0381
+	lda #0x82
+	sta 0x0382
+	lda #0x83
+	sta 0x0383
+	lda #0x84
+	sta 0x0384
+	lda #0x85
+	sta 0x0385
+	lda #0x86
+	sta 0x0386
+	lda #0x87
+	sta 0x0387
+	lda #0x88
+	sta 0x0388
+	lda #0x89
+	sta 0x0389
+	lda #0x8a
+	sta 0x038a
+	lda #0x8b
+	sta 0x038b
+	lda #0x8c
+	sta 0x038c
+	lda #0x8d
+	sta 0x038d
+	lda #0x8e
+	sta 0x038e
+	lda #0x8f
+	sta 0x038f
+	lda #0x90
+	sta 0x0390
+	lda #0x91
+	sta 0x0391
+	lda #0x92
+	sta 0x0392
+	lda #0x93
+	sta 0x0393
+	lda #0x94
+	sta 0x0394
+	lda #0x95
+	sta 0x0395
+	lda #0x96
+	sta 0x0396
+	lda #0x97
+	sta 0x0397
+	lda #0x98
+	sta 0x0398
+	lda #0x99
+	sta 0x0399
+	lda #0x9a
+	sta 0x039a
+	lda #0x9b
+	sta 0x039b
+	lda #0x9c
+	sta 0x039c
+	lda #0x9d
+	sta 0x039d
+	lda #0x9e
+	sta 0x039e
+	lda #0x9f
+	sta 0x039f
+	lda #0xa0
+	sta 0x03a0
+	lda #0xa1
+	sta 0x03a1
+	lda #0xa2
+	sta 0x03a2
+	lda #0xa3
+	sta 0x03a3
+	lda #0xa4
+	sta 0x03a4
+	lda #0xa5
+	sta 0x03a5
+	lda #0xa6
+	sta 0x03a6
+	lda #0xa7
+	sta 0x03a7
+	lda #0xa8
+	sta 0x03a8
+	lda #0xa9
+	sta 0x03a9
+	lda #0xaa
+	sta 0x03aa
+	lda #0xab
+	sta 0x03ab
+	lda #0xac
+	sta 0x03ac
+	lda #0xad
+	sta 0x03ad
+	lda #0xae
+	sta 0x03ae
+	lda #0xaf
+	sta 0x03af
+	lda #0xb0
+	sta 0x03b0
+	lda #0xb1
+	sta 0x03b1
+	lda #0xb2
+	sta 0x03b2
+	lda #0xb3
+	sta 0x03b3
+	lda #0xb4
+	sta 0x03b4
+	lda #0xb5
+	sta 0x03b5
+	lda #0xb6
+	sta 0x03b6
+	lda #0xb7
+	sta 0x03b7
+	lda #0xb8
+	sta 0x03b8
+	lda #0xb9
+	sta 0x03b9
+	lda #0xba
+	sta 0x03ba
+	lda #0xbb
+	sta 0x03bb
+	lda #0xbc
+	sta 0x03bc
+	lda #0xbd
+	sta 0x03bd
+	lda #0xbe
+	sta 0x03be
+	lda #0xbf
+	sta 0x03bf
+	lda #0xc0
+	sta 0x03c0
+	lda #0xc1
+	sta 0x03c1
+	lda #0xc2
+	sta 0x03c2
+	lda #0xc3
+	sta 0x03c3
+	lda #0xc4
+	sta 0x03c4
+	lda #0xc5
+	sta 0x03c5
+	lda #0xc6
+	sta 0x03c6
+	lda #0xc7
+	sta 0x03c7
+	lda #0xc8
+	sta 0x03c8
+	lda #0xc9
+	sta 0x03c9
+	lda #0xca
+	sta 0x03ca
+	lda #0xcb
+	sta 0x03cb
+	lda #0xcc
+	sta 0x03cc
+	lda #0xcd
+	sta 0x03cd
+	lda #0xce
+	sta 0x03ce
+	lda #0xcf
+	sta 0x03cf
+	lda #0xd0
+	sta 0x03d0
+	lda #0xd1
+	sta 0x03d1
+	lda #0xd2
+	sta 0x03d2
+	lda #0xd3
+	sta 0x03d3
+	lda #0xd4
+	sta 0x03d4
+	lda #0xd5
+	sta 0x03d5
+	lda #0xd6
+	sta 0x03d6
+	lda #0xd7
+	sta 0x03d7
+	lda #0xd8
+	sta 0x03d8
+	lda #0xd9
+	sta 0x03d9
+	lda #0xda
+	sta 0x03da
+	lda #0xdb
+	sta 0x03db
+	lda #0xdc
+	sta 0x03dc
+	lda #0xdd
+	sta 0x03dd
+	lda #0xde
+	sta 0x03de
+	lda #0xdf
+	sta 0x03df
+	lda #0xe0
+	sta 0x03e0
+	lda #0xe1
+	sta 0x03e1
+	lda #0xe2
+	sta 0x03e2
+	lda #0xe3
+	sta 0x03e3
+	lda #0xe4
+	sta 0x03e4
+	lda #0xe5
+	sta 0x03e5
+	lda #0xe6
+	sta 0x03e6
+	lda #0xe7
+	sta 0x03e7
+	lda #0xe8
+	sta 0x03e8
+	lda #0xe9
+	sta 0x03e9
+	lda #0xea
+	sta 0x03ea
+	lda #0xeb
+	sta 0x03eb
+	lda #0xec
+	sta 0x03ec
+	lda #0xed
+	sta 0x03ed
+	lda #0xee
+	sta 0x03ee
+	lda #0xef
+	sta 0x03ef
+	lda #0xf0
+	sta 0x03f0
+	lda #0xf1
+	sta 0x03f1
+	lda #0xf2
+	sta 0x03f2
+	lda #0xf3
+	sta 0x03f3
+	lda #0xf4
+	sta 0x03f4
+	lda #0xf5
+	sta 0x03f5
+	lda #0xf6
+	sta 0x03f6
+	lda #0xf7
+	sta 0x03f7
+	lda #0xf8
+	sta 0x03f8
+	lda #0xf9
+	sta 0x03f9
+	lda #0xfa
+	sta 0x03fa
+	lda #0xfb
+	sta 0x03fb
+	lda #0xfc
+	sta 0x03fc
+	lda #0xfd
+	sta 0x03fd
+	lda #0xfe
+	sta 0x03fe
+	lda #0xff
+	sta 0x03ff
+	lda #0x00
+	sta 0x0400
+	lda #0x01
+	sta 0x0401
+	lda #0x02
+	sta 0x0402
+	lda #0x03
+	sta 0x0403
+	lda #0x04
+	sta 0x0404
+	lda #0x05
+	sta 0x0405
+	lda #0x06
+	sta 0x0406
+	lda #0x07
+	sta 0x0407
+	lda #0x08
+	sta 0x0408
+	lda #0x09
+	sta 0x0409
+	lda #0x0a
+	sta 0x040a
+	lda #0x0b
+	sta 0x040b
+	lda #0x0c
+	sta 0x040c
+	lda #0x0d
+	sta 0x040d
+	lda #0x0e
+	sta 0x040e
+	lda #0x0f
+	sta 0x040f
+	lda #0x10
+	sta 0x0410
+	lda #0x11
+	sta 0x0411
+	lda #0x12
+	sta 0x0412
+	lda #0x13
+	sta 0x0413
+	lda #0x14
+	sta 0x0414
+	lda #0x15
+	sta 0x0415
+	lda #0x16
+	sta 0x0416
+	lda #0x17
+	sta 0x0417
+	lda #0x18
+	sta 0x0418
+	lda #0x19
+	sta 0x0419
+	lda #0x1a
+	sta 0x041a
+	lda #0x1b
+	sta 0x041b
+	lda #0x1c
+	sta 0x041c
+	lda #0x1d
+	sta 0x041d
+	lda #0x1e
+	sta 0x041e
+	lda #0x1f
+	sta 0x041f
+	lda #0x20
+	sta 0x0420
+	lda #0x21
+	sta 0x0421
+	lda #0x22
+	sta 0x0422
+	lda #0x23
+	sta 0x0423
+	lda #0x24
+	sta 0x0424
+	lda #0x25
+	sta 0x0425
+	lda #0x26
+	sta 0x0426
+	lda #0x27
+	sta 0x0427
+	lda #0x28
+	sta 0x0428
+	lda #0x29
+	sta 0x0429
+	lda #0x2a
+	sta 0x042a
+	lda #0x2b
+	sta 0x042b
+	lda #0x2c
+	sta 0x042c
+	lda #0x2d
+	sta 0x042d
+	lda #0x2e
+	sta 0x042e
+	lda #0x2f
+	sta 0x042f
+	lda #0x30
+	sta 0x0430
+	lda #0x31
+	sta 0x0431
+	lda #0x32
+	sta 0x0432
+	lda #0x33
+	sta 0x0433
+	lda #0x34
+	sta 0x0434
+	lda #0x35
+	sta 0x0435
+	lda #0x36
+	sta 0x0436
+	lda #0x37
+	sta 0x0437
+	lda #0x38
+	sta 0x0438
+	lda #0x39
+	sta 0x0439
+	lda #0x3a
+	sta 0x043a
+	lda #0x3b
+	sta 0x043b
+	lda #0x3c
+	sta 0x043c
+	lda #0x3d
+	sta 0x043d
+	lda #0x3e
+	sta 0x043e
+	lda #0x3f
+	sta 0x043f
+	lda #0x40
+	sta 0x0440
+	lda #0x41
+	sta 0x0441
+	lda #0x42
+	sta 0x0442
+	lda #0x43
+	sta 0x0443
+	lda #0x44
+	sta 0x0444
+	lda #0x45
+	sta 0x0445
+	lda #0x46
+	sta 0x0446
+	lda #0x47
+	sta 0x0447
+	lda #0x48
+	sta 0x0448
+	lda #0x49
+	sta 0x0449
+	lda #0x4a
+	sta 0x044a
+	lda #0x4b
+	sta 0x044b
+	lda #0x4c
+	sta 0x044c
+	lda #0x4d
+	sta 0x044d
+	lda #0x4e
+	sta 0x044e
+	lda #0x4f
+	sta 0x044f
+	lda #0x50
+	sta 0x0450
+	lda #0x51
+	sta 0x0451
+	lda #0x52
+	sta 0x0452
+	lda #0x53
+	sta 0x0453
+	lda #0x54
+	sta 0x0454
+	lda #0x55
+	sta 0x0455
+	lda #0x56
+	sta 0x0456
+	lda #0x57
+	sta 0x0457
+	lda #0x58
+	sta 0x0458
+	lda #0x59
+	sta 0x0459
+	lda #0x5a
+	sta 0x045a
+	lda #0x5b
+	sta 0x045b
+	lda #0x5c
+	sta 0x045c
+	lda #0x5d
+	sta 0x045d
+	lda #0x5e
+	sta 0x045e
+	lda #0x5f
+	sta 0x045f
+	lda #0x60
+	sta 0x0460
+	lda #0x61
+	sta 0x0461
+	lda #0x62
+	sta 0x0462
+	lda #0x63
+	sta 0x0463
+	lda #0x64
+	sta 0x0464
+	lda #0x65
+	sta 0x0465
+	lda #0x66
+	sta 0x0466
+	lda #0x67
+	sta 0x0467
+	lda #0x68
+	sta 0x0468
+	lda #0x69
+	sta 0x0469
+	lda #0x6a
+	sta 0x046a
+	lda #0x6b
+	sta 0x046b
+	lda #0x6c
+	sta 0x046c
+	lda #0x6d
+	sta 0x046d
+	lda #0x6e
+	sta 0x046e
+	lda #0x6f
+	sta 0x046f
+	lda #0x70
+	sta 0x0470
+	lda #0x71
+	sta 0x0471
+	lda #0x72
+	sta 0x0472
+	lda #0x73
+	sta 0x0473
+	lda #0x74
+	sta 0x0474
+	lda #0x75
+	sta 0x0475
+	lda #0x76
+	sta 0x0476
+	lda #0x77
+	sta 0x0477
+	lda #0x78
+	sta 0x0478
+	lda #0x79
+	sta 0x0479
+	lda #0x7a
+	sta 0x047a
+	lda #0x7b
+	sta 0x047b
+	lda #0x7c
+	sta 0x047c
+	lda #0x7d
+	sta 0x047d
+	lda #0x7e
+	sta 0x047e
+	lda #0x7f
+	sta 0x047f
+	lda #0x80
+	sta 0x0480
+	lda #0x81
+	sta 0x0481
+	lda #0x82
+	sta 0x0482
+	lda #0x83
+	sta 0x0483
+	lda #0x84
+	sta 0x0484
+	lda #0x85
+	sta 0x0485
+	lda #0x86
+	sta 0x0486
+	lda #0x87
+	sta 0x0487
+	lda #0x88
+	sta 0x0488
+	lda #0x89
+	sta 0x0489
+	lda #0x8a
+	sta 0x048a
+	lda #0x8b
+	sta 0x048b
+	lda #0x8c
+	sta 0x048c
+	lda #0x8d
+	sta 0x048d
+	lda #0x8e
+	sta 0x048e
+	lda #0x8f
+	sta 0x048f
+	lda #0x90
+	sta 0x0490
+	lda #0x91
+	sta 0x0491
+	lda #0x92
+	sta 0x0492
+	lda #0x93
+	sta 0x0493
+	lda #0x94
+	sta 0x0494
+	lda #0x95
+	sta 0x0495
+	lda #0x96
+	sta 0x0496
+	lda #0x97
+	sta 0x0497
+	lda #0x98
+	sta 0x0498
+	lda #0x99
+	sta 0x0499
+	lda #0x9a
+	sta 0x049a
+	lda #0x9b
+	sta 0x049b
+	lda #0x9c
+	sta 0x049c
+	lda #0x9d
+	sta 0x049d
+	lda #0x9e
+	sta 0x049e
+	lda #0x9f
+	sta 0x049f
+	lda #0xa0
+	sta 0x04a0
+	lda #0xa1
+	sta 0x04a1
+	lda #0xa2
+	sta 0x04a2
+	lda #0xa3
+	sta 0x04a3
+	lda #0xa4
+	sta 0x04a4
+	lda #0xa5
+	sta 0x04a5
+	lda #0xa6
+	sta 0x04a6
+	lda #0xa7
+	sta 0x04a7
+	lda #0xa8
+	sta 0x04a8
+	lda #0xa9
+	sta 0x04a9
+	lda #0xaa
+	sta 0x04aa
+	lda #0xab
+	sta 0x04ab
+	lda #0xac
+	sta 0x04ac
+	lda #0xad
+	sta 0x04ad
+	lda #0xae
+	sta 0x04ae
+	lda #0xaf
+	sta 0x04af
+	lda #0xb0
+	sta 0x04b0
+	lda #0xb1
+	sta 0x04b1
+	lda #0xb2
+	sta 0x04b2
+	lda #0xb3
+	sta 0x04b3
+	lda #0xb4
+	sta 0x04b4
+	lda #0xb5
+	sta 0x04b5
+	lda #0xb6
+	sta 0x04b6
+	lda #0xb7
+	sta 0x04b7
+	lda #0xb8
+	sta 0x04b8
+	lda #0xb9
+	sta 0x04b9
+	lda #0xba
+	sta 0x04ba
+	lda #0xbb
+	sta 0x04bb
+	lda #0xbc
+	sta 0x04bc
+	lda #0xbd
+	sta 0x04bd
+	lda #0xbe
+	sta 0x04be
+	lda #0xbf
+	sta 0x04bf
+	lda #0xc0
+	sta 0x04c0
+	lda #0xc1
+	sta 0x04c1
+	lda #0xc2
+	sta 0x04c2
+	lda #0xc3
+	sta 0x04c3
+	lda #0xc4
+	sta 0x04c4
+	lda #0xc5
+	sta 0x04c5
+	lda #0xc6
+	sta 0x04c6
+	lda #0xc7
+	sta 0x04c7
+	lda #0xc8
+	sta 0x04c8
+	lda #0xc9
+	sta 0x04c9
+	lda #0xca
+	sta 0x04ca
+	lda #0xcb
+	sta 0x04cb
+	lda #0xcc
+	sta 0x04cc
+	lda #0xcd
+	sta 0x04cd
+	lda #0xce
+	sta 0x04ce
+	lda #0xcf
+	sta 0x04cf
+	lda #0xd0
+	sta 0x04d0
+	lda #0xd1
+	sta 0x04d1
+	lda #0xd2
+	sta 0x04d2
+	lda #0xd3
+	sta 0x04d3
+	lda #0xd4
+	sta 0x04d4
+	lda #0xd5
+	sta 0x04d5
+	lda #0xd6
+	sta 0x04d6
+	lda #0xd7
+	sta 0x04d7
+	lda #0xd8
+	sta 0x04d8
+	lda #0xd9
+	sta 0x04d9
+	lda #0xda
+	sta 0x04da
+	lda #0xdb
+	sta 0x04db
+	lda #0xdc
+	sta 0x04dc
+	lda #0xdd
+	sta 0x04dd
+	lda #0xde
+	sta 0x04de
+	lda #0xdf
+	sta 0x04df
+	lda #0xe0
+	sta 0x04e0
+	lda #0xe1
+	sta 0x04e1
+	lda #0xe2
+	sta 0x04e2
+	lda #0xe3
+	sta 0x04e3
+	lda #0xe4
+	sta 0x04e4
+	lda #0xe5
+	sta 0x04e5
+	lda #0xe6
+	sta 0x04e6
+	lda #0xe7
+	sta 0x04e7
+	lda #0xe8
+	sta 0x04e8
+	lda #0xe9
+	sta 0x04e9
+	lda #0xea
+	sta 0x04ea
+	lda #0xeb
+	sta 0x04eb
+	lda #0xec
+	sta 0x04ec
+	lda #0xed
+	sta 0x04ed
+	lda #0xee
+	sta 0x04ee
+	lda #0xef
+	sta 0x04ef
+	lda #0xf0
+	sta 0x04f0
+
+	@inc "page.inc"
+
+	brk
\ No newline at end of file
@@ -0,0 +1,5 @@
+	.org 0x0600
+
+	@inc "regs.a65p"
+
+	brk
@@ -0,0 +1,13 @@
+	.org 0x0600
+
+start:
+	bne far
+	beq near
+	bra far
+near:
+	.res 0x0100
+far:
+	bcc start
+	bvs start
+	bpl far
+	rts
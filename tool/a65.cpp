@@ -19,26 +19,108 @@
 #include <iostream>
 #include "./a65_type.h"
 
+void
+build_object_worker(
+	__inout std::atomic<size_t> &next,
+	__inout std::atomic<bool> &failed,
+	__inout std::vector<std::string> &paths,
+	__inout std::vector<std::string> &errors,
+	__inout std::atomic<size_t> &relaxed,
+	__inout std::atomic<size_t> &hit,
+	__inout std::atomic<size_t> &miss,
+	__in const std::vector<std::string> &sources,
+	__in const std::vector<std::string> &include,
+	__in const std::string &cache,
+	__in const std::string &depend,
+	__in const std::string &output,
+	__in bool header,
+	__in bool source,
+	__in bool relax,
+	__in bool dependency
+	)
+{
+	size_t index;
+	a65_context_t *context = a65_context_create();
+
+	for(std::vector<std::string>::const_iterator entry = include.begin(); entry != include.end(); ++entry) {
+		a65_add_include_path_r(context, entry->c_str());
+	}
+
+	a65_set_cache_path_r(context, cache.c_str());
+	a65_set_depend_path_r(context, depend.c_str());
+	a65_set_option_r(context, A65_OPTION_DEPEND, dependency);
+	a65_set_option_r(context, A65_OPTION_RELAX, relax);
+
+	while(!failed && ((index = next++) < sources.size())) {
+
+		if(a65_build_object_r(context, sources.at(index).c_str(), output.c_str(), header, source)) {
+			errors.at(index) = a65_error_r(context);
+			failed = true;
+		} else {
+			paths.at(index) = a65_output_path_r(context);
+			relaxed += a65_statistic_r(context, A65_STATISTIC_RELAXED);
+			hit += a65_statistic_r(context, A65_STATISTIC_CACHE_HIT);
+			miss += a65_statistic_r(context, A65_STATISTIC_CACHE_MISS);
+		}
+	}
+
+	a65_context_destroy(context);
+}
+
 int
 build_objects(
 	__inout std::vector<std::string> &objects,
+	__inout std::string &error,
+	__inout size_t &relaxed,
+	__inout size_t &hit,
+	__inout size_t &miss,
 	__in const std::vector<std::string> &sources,
+	__in const std::vector<std::string> &include,
+	__in const std::string &cache,
+	__in const std::string &depend,
 	__in const std::string &output,
 	__in bool header,
-	__in bool source
+	__in bool source,
+	__in bool relax,
+	__in bool dependency,
+	__in size_t jobs
 	)
 {
+	size_t index;
+	std::atomic<size_t> hit_count(0), miss_count(0), next(0), relaxed_count(0);
 	int result = EXIT_SUCCESS;
-	std::vector<std::string>::const_iterator entry;
+	std::atomic<bool> failed(false);
+	std::vector<std::thread> workers;
+	std::vector<std::string> errors(sources.size()), paths(sources.size());
 
-	for(entry = sources.begin(); entry != sources.end(); ++entry) {
+	jobs = std::min(std::max(jobs, (size_t) 1), sources.size());
 
-		result = a65_build_object(entry->c_str(), output.c_str(), header, source);
-		if(result) {
+	for(index = 1; index < jobs; ++index) {
+		workers.push_back(std::thread(build_object_worker, std::ref(next), std::ref(failed), std::ref(paths), std::ref(errors),
+			std::ref(relaxed_count), std::ref(hit_count), std::ref(miss_count), std::cref(sources), std::cref(include), std::cref(cache),
+			std::cref(depend), std::cref(output), header, source, relax, dependency));
+	}
+
+	build_object_worker(next, failed, paths, errors, relaxed_count, hit_count, miss_count, sources, include, cache, depend, output, header,
+		source, relax, dependency);
+
+	for(std::vector<std::thread>::iterator entry = workers.begin(); entry != workers.end(); ++entry) {
+		entry->join();
+	}
+
+	hit = hit_count;
+	miss = miss_count;
+	relaxed = relaxed_count;
+
+	for(index = 0; index < sources.size(); ++index) {
+
+		if(failed && (paths.at(index).empty() || !errors.at(index).empty())) {
+			error = errors.at(index);
+			result = EXIT_FAILURE;
 			break;
 		}
 
-		objects.push_back(a65_output_path());
+		objects.push_back(paths.at(index));
 	}
 
 	return result;
@@ -47,17 +129,28 @@ build_objects(
 int
 build_archive(
 	__inout std::vector<std::string> &objects,
+	__inout std::string &error,
+	__inout size_t &relaxed,
+	__inout size_t &hit,
+	__inout size_t &miss,
 	__in const std::vector<std::string> &sources,
+	__in const std::vector<std::string> &include,
+	__in const std::string &cache,
+	__in const std::string &depend,
 	__in const std::string &output,
 	__in const std::string &name,
 	__in bool header,
-	__in bool source
+	__in bool source,
+	__in bool relax,
+	__in bool dependency,
+	__in size_t jobs
 	)
 {
 	int result = EXIT_SUCCESS;
 
 	if(!sources.empty()) {
-		result = build_objects(objects, sources, output, header, source);
+		result = build_objects(objects, error, relaxed, hit, miss, sources, include, cache, depend, output, header, source, relax,
+			dependency, jobs);
 	}
 
 	if(result == EXIT_SUCCESS) {
@@ -68,6 +161,9 @@ build_archive(
 		}
 
 		result = a65_build_archive(inputs.size(), (const char **)&inputs[0], output.c_str(), name.c_str());
+		if(result) {
+			error = a65_error();
+		}
 	}
 
 	return result;
@@ -76,20 +172,31 @@ build_archive(
 int
 compile(
 	__inout std::vector<std::string> &objects,
+	__inout std::string &error,
+	__inout size_t &relaxed,
+	__inout size_t &hit,
+	__inout size_t &miss,
 	__in const std::vector<std::string> &archives,
 	__in const std::vector<std::string> &sources,
+	__in const std::vector<std::string> &include,
+	__in const std::string &cache,
+	__in const std::string &depend,
 	__in const std::string &output,
 	__in const std::string &name,
 	__in bool header,
 	__in bool source,
 	__in bool binary,
-	__in bool ihex
+	__in bool ihex,
+	__in bool relax,
+	__in bool dependency,
+	__in size_t jobs
 	)
 {
 	int result = EXIT_SUCCESS;
 
 	if(!sources.empty()) {
-		result = build_objects(objects, sources, output, header, source);
+		result = build_objects(objects, error, relaxed, hit, miss, sources, include, cache, depend, output, header, source, relax,
+			dependency, jobs);
 	}
 
 	if(result == EXIT_SUCCESS) {
@@ -104,11 +211,43 @@ compile(
 		}
 
 		result = a65_compile(inputs.size(), (const char **)&inputs[0], output.c_str(), name.c_str(), binary, ihex);
+		if(result) {
+			error = a65_error();
+		}
 	}
 
 	return result;
 }
 
+int
+precompile(
+	__inout std::string &error,
+	__in const std::vector<std::string> &sources,
+	__in const std::vector<std::string> &include,
+	__in const std::string &output
+	)
+{
+	int result = EXIT_SUCCESS;
+	a65_context_t *context = a65_context_create();
+
+	for(std::vector<std::string>::const_iterator entry = include.begin(); entry != include.end(); ++entry) {
+		a65_add_include_path_r(context, entry->c_str());
+	}
+
+	for(std::vector<std::string>::const_iterator entry = sources.begin(); entry != sources.end(); ++entry) {
+
+		result = a65_precompile_r(context, entry->c_str(), output.c_str());
+		if(result) {
+			error = a65_error_r(context);
+			break;
+		}
+	}
+
+	a65_context_destroy(context);
+
+	return result;
+}
+
 void
 display_version(
 	__in_opt bool verbose = false
@@ -160,8 +299,8 @@ display_usage(
 		std::cout << std::endl;
 
 		for(int flag = 0; flag <= A65_FLAG_MAX; ++flag) {
-			std::cout << std::endl << A65_FLAG_SHORT_STRING(flag) << "|" << A65_COLUMN_WIDTH(A65_FLAG_COLUMN_WIDTH)
-				<< A65_FLAG_LONG_STRING(flag) << A65_FLAG_DESCRIPTION_STRING(flag);
+			std::cout << std::endl << A65_COLUMN_WIDTH(A65_FLAG_COLUMN_WIDTH)
+				<< (std::string(A65_FLAG_SHORT_STRING(flag)) + "|" + A65_FLAG_LONG_STRING(flag)) << A65_FLAG_DESCRIPTION_STRING(flag);
 		}
 	}
 
@@ -172,10 +311,14 @@ int
 parse(
 	__in const std::vector<std::string> &arguments,
 	__inout std::vector<std::string> &input,
+	__inout std::vector<std::string> &include,
+	__inout std::string &cache,
+	__inout std::string &depend,
 	__inout std::string &output,
 	__inout std::string &name,
 	__inout std::string &error,
-	__inout int &flags
+	__inout int &flags,
+	__inout size_t &jobs
 	)
 {
 	std::stringstream stream;
@@ -183,8 +326,12 @@ parse(
 	std::vector<std::string>::const_iterator argument;
 
 	flags = 0;
+	jobs = A65_JOBS_DEFAULT;
 
+	cache.clear();
+	depend.clear();
 	error.clear();
+	include.clear();
 	input.clear();
 	name.clear();
 	output.clear();
@@ -221,15 +368,67 @@ parse(
 							name = *(++argument);
 						}
 						break;
+					case A65_FLAG_CACHE:
+						A65_FLAG_APPEND(A65_FLAG_CACHE, flags);
+
+						if(argument == (arguments.end() - 1)) {
+							stream << "Undefined flag parameter: " << *argument;
+							result = EXIT_FAILURE;
+						} else {
+							cache = *(++argument);
+						}
+						break;
+					case A65_FLAG_DEPEND_FILE:
+						A65_FLAG_APPEND(A65_FLAG_DEPEND_FILE, flags);
+
+						if(argument == (arguments.end() - 1)) {
+							stream << "Undefined flag parameter: " << *argument;
+							result = EXIT_FAILURE;
+						} else {
+							depend = *(++argument);
+						}
+						break;
+					case A65_FLAG_DEPEND:
 					case A65_FLAG_EXPORT:
 					case A65_FLAG_IHEX:
 					case A65_FLAG_HELP:
 					case A65_FLAG_NO_BINARY:
+					case A65_FLAG_PRECOMPILE:
+					case A65_FLAG_RELAX:
 					case A65_FLAG_SOURCE:
 					case A65_FLAG_VERBOSE:
 					case A65_FLAG_VERSION:
 						A65_FLAG_APPEND(id, flags);
 						break;
+					case A65_FLAG_INCLUDE:
+						A65_FLAG_APPEND(A65_FLAG_INCLUDE, flags);
+
+						if(argument == (arguments.end() - 1)) {
+							stream << "Undefined flag parameter: " << *argument;
+							result = EXIT_FAILURE;
+						} else {
+							include.push_back(*(++argument));
+						}
+						break;
+					case A65_FLAG_JOBS:
+						A65_FLAG_APPEND(A65_FLAG_JOBS, flags);
+
+						if(argument == (arguments.end() - 1)) {
+							stream << "Undefined flag parameter: " << *argument;
+							result = EXIT_FAILURE;
+						} else {
+							char *end = nullptr;
+							const std::string &value = *(++argument);
+
+							jobs = std::strtoul(value.c_str(), &end, 10);
+							if(value.empty() || *end) {
+								stream << "Invalid flag parameter: " << value;
+								result = EXIT_FAILURE;
+							} else if(!jobs) {
+								jobs = std::max(std::thread::hardware_concurrency(), (unsigned) A65_JOBS_DEFAULT);
+							}
+						}
+						break;
 					case A65_FLAG_OUTPUT:
 
 						if(argument == (arguments.end() - 1)) {
@@ -277,17 +476,25 @@ parse(
 int
 run(
 	__in const std::vector<std::string> &input,
+	__in const std::vector<std::string> &include,
+	__in const std::string &cache,
+	__in const std::string &depend,
 	__in const std::string &output,
 	__in const std::string &name,
-	__in int flags
+	__in int flags,
+	__in size_t jobs
 	)
 {
+	std::string error;
+	size_t hit = 0, miss = 0, relaxed = 0;
 	int result = EXIT_SUCCESS;
 	std::vector<std::string>::const_iterator entry;
 	std::vector<std::string> archives, objects, sources;
 	bool binary = !A65_FLAG_CONTAINS(A65_FLAG_NO_BINARY, flags),
+		dependency = (A65_FLAG_CONTAINS(A65_FLAG_DEPEND, flags) || A65_FLAG_CONTAINS(A65_FLAG_DEPEND_FILE, flags)),
 		header = A65_FLAG_CONTAINS(A65_FLAG_EXPORT, flags),
 		ihex = A65_FLAG_CONTAINS(A65_FLAG_IHEX, flags),
+		relax = A65_FLAG_CONTAINS(A65_FLAG_RELAX, flags),
 		source = A65_FLAG_CONTAINS(A65_FLAG_SOURCE, flags),
 		verbose = A65_FLAG_CONTAINS(A65_FLAG_VERBOSE, flags);
 
@@ -334,10 +541,19 @@ run(
 	}
 
 	if(verbose) {
-		std::cout << "Output: " << A65_STRING_CHECK(output) << std::endl;
+		std::cout << "Cache: " << A65_STRING_CHECK(cache) << std::endl
+			<< "Output: " << A65_STRING_CHECK(output) << std::endl
+			<< "Jobs: " << jobs << std::endl
+			<< "Relax: " << (relax ? "true" : "false") << std::endl;
 	}
 
-	if(A65_FLAG_CONTAINS(A65_FLAG_ARCHIVE, flags)) {
+	if(!depend.empty() && (sources.size() > 1)) {
+		std::stringstream stream;
+
+		stream << "Unsupported flag combination: " << A65_FLAG_SHORT_STRING(A65_FLAG_DEPEND_FILE) << " with multiple sources";
+		error = stream.str();
+		result = EXIT_FAILURE;
+	} else if(A65_FLAG_CONTAINS(A65_FLAG_ARCHIVE, flags)) {
 
 		if(verbose) {
 			std::cout << A65_VERBOSE_DIVIDER
@@ -347,7 +563,8 @@ run(
 				<< std::endl;
 		}
 
-		result = build_archive(objects, sources, output, name, header, source);
+		result = build_archive(objects, error, relaxed, hit, miss, sources, include, cache, depend, output, name, header, source, relax,
+			dependency, jobs);
 	} else if(A65_FLAG_CONTAINS(A65_FLAG_COMPILE, flags)) {
 
 		if(verbose) {
@@ -358,7 +575,18 @@ run(
 				<< std::endl;
 		}
 
-		result = compile(objects, archives, sources, output, name, header, source, binary, ihex);
+		result = compile(objects, error, relaxed, hit, miss, archives, sources, include, cache, depend, output, name, header, source,
+			binary, ihex, relax, dependency, jobs);
+	} else if(A65_FLAG_CONTAINS(A65_FLAG_PRECOMPILE, flags)) {
+
+		if(verbose) {
+			std::cout << A65_VERBOSE_DIVIDER
+				<< std::endl << A65_VERBOSE_SECTION_PRECOMPILE
+				<< std::endl << A65_VERBOSE_DIVIDER
+				<< std::endl;
+		}
+
+		result = precompile(error, sources, include, output);
 	} else {
 
 		if(verbose) {
@@ -379,13 +607,25 @@ run(
 				<< std::endl;
 		}
 
-		result = build_objects(objects, sources, output, header, source);
+		result = build_objects(objects, error, relaxed, hit, miss, sources, include, cache, depend, output, header, source, relax,
+			dependency, jobs);
 	}
 
 	if(result) {
-		std::cerr << "Error: " << a65_error() << std::endl;
-	} else if(verbose) {
-		std::cout << "Success" << std::endl;
+		std::cerr << "Error: " << error << std::endl;
+	} else {
+
+		if(!cache.empty()) {
+			std::cout << "Cache hits: " << hit << ", misses: " << miss << std::endl;
+		}
+
+		if(relax) {
+			std::cout << "Relaxed branches: " << relaxed << std::endl;
+		}
+
+		if(verbose) {
+			std::cout << "Success" << std::endl;
+		}
 	}
 
 	return result;
@@ -401,10 +641,11 @@ main(
 
 	if(argc >= A65_ARGUMENTS_MIN) {
 		int flags = 0;
-		std::vector<std::string> input;
-		std::string error, name, output;
+		size_t jobs = A65_JOBS_DEFAULT;
+		std::vector<std::string> include, input;
+		std::string cache, depend, error, name, output;
 
-		result = parse(std::vector<std::string>(argv + 1, argv + argc), input, output, name, error, flags);
+		result = parse(std::vector<std::string>(argv + 1, argv + argc), input, include, cache, depend, output, name, error, flags, jobs);
 		if(result == EXIT_SUCCESS) {
 
 			if(A65_FLAG_CONTAINS(A65_FLAG_HELP, flags)) {
@@ -412,7 +653,7 @@ main(
 			} else if(A65_FLAG_CONTAINS(A65_FLAG_VERSION, flags)) {
 				display_version();
 			} else {
-				result = run(input, output, name, flags);
+				result = run(input, include, cache, depend, output, name, flags, jobs);
 			}
 		} else {
 			display_usage();
@@ -19,6 +19,8 @@
 #ifndef A65_TYPE_H_
 #define A65_TYPE_H_
 
+#include <atomic>
+#include <thread>
 #include "../inc/a65.h"
 #include "../inc/a65_utility.h"
 
@@ -42,18 +44,27 @@
 
 enum {
 	A65_FLAG_ARCHIVE = 0,
+	A65_FLAG_CACHE,
 	A65_FLAG_COMPILE,
+	A65_FLAG_DEPEND,
+	A65_FLAG_DEPEND_FILE,
 	A65_FLAG_EXPORT,
 	A65_FLAG_HELP,
 	A65_FLAG_IHEX,
+	A65_FLAG_INCLUDE,
+	A65_FLAG_JOBS,
 	A65_FLAG_NO_BINARY,
 	A65_FLAG_OUTPUT,
+	A65_FLAG_PRECOMPILE,
+	A65_FLAG_RELAX,
 	A65_FLAG_SOURCE,
 	A65_FLAG_VERBOSE,
 	A65_FLAG_VERSION,
 };
 
-#define A65_FLAG_COLUMN_WIDTH 14
+#define A65_FLAG_COLUMN_WIDTH 18
+
+#define A65_JOBS_DEFAULT 1
 
 #define A65_FLAG_DELIMITER "-"
 
@@ -61,12 +72,19 @@ enum {
 
 static const std::string A65_FLAG_DESC_STR[] = {
 	"Output archive file",
+	"Specify object cache directory",
 	"Output binary file",
+	"Output dependency file",
+	"Specify dependency file path",
 	"Output export file",
 	"Display help information",
 	"Output ihex file",
+	"Add include search directory",
+	"Specify worker count (0=all cores)",
 	"Exclude binary file output",
 	"Specify output directory",
+	"Output precompiled include file",
+	"Relax out-of-range branches",
 	"Enable source output",
 	"Enable verbose output",
 	"Display version information",
@@ -78,12 +96,19 @@ static const std::string A65_FLAG_DESC_STR[] = {
 
 static const std::string A65_FLAG_LONG_STR[] = {
 	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "archive",
+	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "cache",
 	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "compile",
+	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "depend",
+	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "depend-file",
 	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "export",
 	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "help",
 	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "ihex",
+	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "include",
+	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "jobs",
 	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "no-binary",
 	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "output",
+	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "precompile",
+	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "relax",
 	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "source",
 	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "verbose",
 	A65_FLAG_DELIMITER A65_FLAG_DELIMITER "version",
@@ -95,12 +120,19 @@ static const std::string A65_FLAG_LONG_STR[] = {
 
 static const std::string A65_FLAG_SHORT_STR[] = {
 	A65_FLAG_DELIMITER "a",
+	A65_FLAG_DELIMITER "C",
 	A65_FLAG_DELIMITER "c",
+	A65_FLAG_DELIMITER "MD",
+	A65_FLAG_DELIMITER "MF",
 	A65_FLAG_DELIMITER "e",
 	A65_FLAG_DELIMITER "h",
 	A65_FLAG_DELIMITER "i",
+	A65_FLAG_DELIMITER "I",
+	A65_FLAG_DELIMITER "j",
 	A65_FLAG_DELIMITER "n",
 	A65_FLAG_DELIMITER "o",
+	A65_FLAG_DELIMITER "p",
+	A65_FLAG_DELIMITER "r",
 	A65_FLAG_DELIMITER "s",
 	A65_FLAG_DELIMITER "b",
 	A65_FLAG_DELIMITER "v",
@@ -112,22 +144,36 @@ static const std::string A65_FLAG_SHORT_STR[] = {
 
 static const std::map<std::string, int> A65_FLAG_MAP = {
 	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_ARCHIVE), A65_FLAG_ARCHIVE),
+	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_CACHE), A65_FLAG_CACHE),
 	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_COMPILE), A65_FLAG_COMPILE),
+	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_DEPEND), A65_FLAG_DEPEND),
+	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_DEPEND_FILE), A65_FLAG_DEPEND_FILE),
 	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_EXPORT), A65_FLAG_EXPORT),
 	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_HELP), A65_FLAG_HELP),
 	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_IHEX), A65_FLAG_IHEX),
+	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_INCLUDE), A65_FLAG_INCLUDE),
+	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_JOBS), A65_FLAG_JOBS),
 	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_NO_BINARY), A65_FLAG_NO_BINARY),
 	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_OUTPUT), A65_FLAG_OUTPUT),
+	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_PRECOMPILE), A65_FLAG_PRECOMPILE),
+	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_RELAX), A65_FLAG_RELAX),
 	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_SOURCE), A65_FLAG_SOURCE),
 	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_VERBOSE), A65_FLAG_VERBOSE),
 	std::make_pair(A65_FLAG_LONG_STRING(A65_FLAG_VERSION), A65_FLAG_VERSION),
 	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_ARCHIVE), A65_FLAG_ARCHIVE),
+	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_CACHE), A65_FLAG_CACHE),
 	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_COMPILE), A65_FLAG_COMPILE),
+	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_DEPEND), A65_FLAG_DEPEND),
+	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_DEPEND_FILE), A65_FLAG_DEPEND_FILE),
 	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_EXPORT), A65_FLAG_EXPORT),
 	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_HELP), A65_FLAG_HELP),
 	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_IHEX), A65_FLAG_IHEX),
+	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_INCLUDE), A65_FLAG_INCLUDE),
+	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_JOBS), A65_FLAG_JOBS),
 	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_NO_BINARY), A65_FLAG_NO_BINARY),
 	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_OUTPUT), A65_FLAG_OUTPUT),
+	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_PRECOMPILE), A65_FLAG_PRECOMPILE),
+	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_RELAX), A65_FLAG_RELAX),
 	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_SOURCE), A65_FLAG_SOURCE),
 	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_VERBOSE), A65_FLAG_VERBOSE),
 	std::make_pair(A65_FLAG_SHORT_STRING(A65_FLAG_VERSION), A65_FLAG_VERSION),
@@ -139,20 +185,31 @@ static const std::map<std::string, int> A65_FLAG_MAP = {
 #define A65_FLAG_ID(_STRING_) \
 	A65_FLAG_MAP.find(_STRING_)->second
 
+static const std::vector<std::string> A65_FLAG_FORMAT_COUNT = { "count" };
+
 static const std::vector<std::string> A65_FLAG_FORMAT_EMPTY;
 
 static const std::vector<std::string> A65_FLAG_FORMAT_NAME = { "name" };
 
 static const std::vector<std::string> A65_FLAG_FORMAT_OUTPUT = { "output" };
 
+static const std::vector<std::string> A65_FLAG_FORMAT_PATH = { "path" };
+
 static const std::map<int, std::pair<std::vector<std::string>, bool>> A65_FLAG_REQUIREMENT_MAP = {
 	std::make_pair(A65_FLAG_ARCHIVE, std::make_pair(A65_FLAG_FORMAT_NAME, false)),
+	std::make_pair(A65_FLAG_CACHE, std::make_pair(A65_FLAG_FORMAT_PATH, false)),
 	std::make_pair(A65_FLAG_COMPILE, std::make_pair(A65_FLAG_FORMAT_NAME, false)),
+	std::make_pair(A65_FLAG_DEPEND, std::make_pair(A65_FLAG_FORMAT_EMPTY, false)),
+	std::make_pair(A65_FLAG_DEPEND_FILE, std::make_pair(A65_FLAG_FORMAT_PATH, false)),
 	std::make_pair(A65_FLAG_EXPORT, std::make_pair(A65_FLAG_FORMAT_EMPTY, false)),
 	std::make_pair(A65_FLAG_HELP, std::make_pair(A65_FLAG_FORMAT_EMPTY, false)),
 	std::make_pair(A65_FLAG_IHEX, std::make_pair(A65_FLAG_FORMAT_EMPTY, false)),
+	std::make_pair(A65_FLAG_INCLUDE, std::make_pair(A65_FLAG_FORMAT_PATH, false)),
+	std::make_pair(A65_FLAG_JOBS, std::make_pair(A65_FLAG_FORMAT_COUNT, false)),
 	std::make_pair(A65_FLAG_NO_BINARY, std::make_pair(A65_FLAG_FORMAT_EMPTY, false)),
 	std::make_pair(A65_FLAG_OUTPUT, std::make_pair(A65_FLAG_FORMAT_OUTPUT, false)),
+	std::make_pair(A65_FLAG_PRECOMPILE, std::make_pair(A65_FLAG_FORMAT_EMPTY, false)),
+	std::make_pair(A65_FLAG_RELAX, std::make_pair(A65_FLAG_FORMAT_EMPTY, false)),
 	std::make_pair(A65_FLAG_SOURCE, std::make_pair(A65_FLAG_FORMAT_EMPTY, false)),
 	std::make_pair(A65_FLAG_VERBOSE, std::make_pair(A65_FLAG_FORMAT_EMPTY, false)),
 	std::make_pair(A65_FLAG_VERSION, std::make_pair(A65_FLAG_FORMAT_EMPTY, false)),
@@ -169,5 +226,6 @@ static const std::map<int, std::pair<std::vector<std::string>, bool>> A65_FLAG_R
 #define A65_VERBOSE_SECTION_ARCHIVE "Generating archive file"
 #define A65_VERBOSE_SECTION_COMPILE "Generating binary file"
 #define A65_VERBOSE_SECTION_OBJECT "Generating object file(s)"
+#define A65_VERBOSE_SECTION_PRECOMPILE "Generating precompiled file(s)"
 
 #endif // A65_TYPE_H_